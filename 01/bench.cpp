@@ -0,0 +1,17 @@
+#include "common/bench.hpp"
+#include "solver.hpp"
+
+using namespace day01;
+
+int main(int argc, char *argv[]) {
+  aoc::Benchmark benchmark("01", argc, argv);
+  const std::string input_file_name = benchmark.input_file_name;
+
+  benchmark.add("process_file", [&]() {
+    Dial dial(50, 100);
+    process_file(input_file_name, dial);
+    aoc::do_not_optimize(dial.zero_counter_all);
+  });
+
+  return benchmark.run();
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <iostream>
+#include <string>
+
+#include "common/input.hpp"
+
+namespace day01 {
+
+class Dial {
+public:
+  int value;
+  const int start_value;
+  const int period;
+  int zero_counter;
+  int zero_counter_all;
+
+  Dial(const int start_value, const int period)
+      : start_value(start_value), value(start_value), period(period),
+        zero_counter(0), zero_counter_all(0){};
+
+  void operator+(int n) {
+    value = value + n;
+    zero_counter_all += value / period;
+    if (value == 0) {
+      --zero_counter_all;
+    }
+    value = value % period;
+    if (value == 0) {
+      zero_counter++;
+    };
+  }
+
+  void operator-(int n) {
+    zero_counter_all += abs((period - value + n) / period);
+    if (value == 0) {
+      --zero_counter_all;
+    }
+    value = (value - n) % period;
+    if (value < 0) {
+      value = period + value;
+    }
+    if (value == 0) {
+      zero_counter++;
+    };
+  }
+
+  void reset() {
+    value = start_value;
+    zero_counter = 0;
+    zero_counter_all = 0;
+  }
+};
+
+inline void process_file(const std::string file_name, Dial &dial) {
+  const std::string input = aoc::read_input(file_name);
+  aoc::LineReader lines(input);
+  std::string_view line;
+  int n;
+  while (lines.next(line)) {
+    n = aoc::parse_integer<int>(line.substr(1));
+    if (line[0] == 'R') {
+      dial + n;
+    } else {
+      dial - n;
+    }
+  }
+}
+
+// Answers to both parts of the puzzle for the given input.
+inline std::array<std::string, 2> solve(const std::string input_file_name) {
+  Dial dial(50, 100);
+  process_file(input_file_name, dial);
+  return {std::to_string(dial.zero_counter),
+          std::to_string(dial.zero_counter_all)};
+}
+
+} // namespace day01
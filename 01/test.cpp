@@ -0,0 +1,82 @@
+#undef NDEBUG
+#include <cassert>
+#include <iostream>
+
+#include "solver.hpp"
+
+using namespace day01;
+
+int main() {
+  std::cout << "Running unit tests ..." << std::endl;
+  Dial dial(50, 100);
+  assert(dial.value == 50);
+  assert(dial.zero_counter == 0);
+  assert(dial.zero_counter_all == 0);
+  dial + 49;
+  assert(dial.value == 99);
+  assert(dial.zero_counter == 0);
+  assert(dial.zero_counter_all == 0);
+
+  dial + 1;
+  assert(dial.value == 0);
+  assert(dial.zero_counter == 1);
+  assert(dial.zero_counter_all == 1);
+
+  dial + 10;
+  dial - 40;
+  assert(dial.value == 70);
+  assert(dial.zero_counter == 1);
+  assert(dial.zero_counter_all == 2);
+
+  dial - 20;
+  assert(dial.value == 50);
+  assert(dial.zero_counter == 1);
+  assert(dial.zero_counter_all == 2);
+
+  dial + 333;
+  assert(dial.value == 83);
+  assert(dial.zero_counter == 1);
+  assert(dial.zero_counter_all == 5);
+
+  dial - 93;
+  assert(dial.value == 90);
+  assert(dial.zero_counter == 1);
+  assert(dial.zero_counter_all == 6);
+
+  dial - 444;
+  assert(dial.value == 46);
+  assert(dial.zero_counter == 1);
+  assert(dial.start_value == 50);
+  assert(dial.zero_counter_all == 10);
+
+  dial.reset();
+  assert(dial.value == 50);
+  assert(dial.zero_counter == 0);
+  assert(dial.zero_counter_all == 0);
+
+  dial - 50;
+  dial - 2;
+  assert(dial.value == 98);
+  assert(dial.zero_counter == 1);
+  assert(dial.zero_counter_all == 1);
+
+  dial + 2;
+  dial + 111;
+  assert(dial.value == 11);
+  assert(dial.zero_counter == 2);
+  assert(dial.zero_counter_all == 3);
+
+  std::cout << "\tUnits tests completed successfully." << std::endl;
+
+  std::cout << "Running AOC test ..." << std::endl;
+  dial.reset();
+  process_file("input_test.txt", dial);
+
+  assert(dial.zero_counter == 3);
+  assert(dial.value == 32);
+  assert(dial.zero_counter_all == 6);
+
+  std::cout << "\tAOC test completed successfully." << std::endl;
+
+  return 0;
+}
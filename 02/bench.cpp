@@ -0,0 +1,18 @@
+#include "common/bench.hpp"
+#include "solver.hpp"
+
+using namespace day02;
+
+int main(int argc, char *argv[]) {
+  aoc::Benchmark benchmark("02", argc, argv);
+  const std::string input_file_name = benchmark.input_file_name;
+
+  benchmark.add("read_ranges", [&]() {
+    aoc::do_not_optimize(read_ranges(input_file_name));
+  });
+  benchmark.add("process_file", [&]() {
+    aoc::do_not_optimize(process_file(input_file_name));
+  });
+
+  return benchmark.run();
+}
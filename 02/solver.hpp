@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "common/input.hpp"
+
+namespace day02 {
+
+inline std::vector<std::pair<long long, long long>>
+read_ranges(const std::string input_file_name) {
+  const std::string input = aoc::read_input(input_file_name);
+  aoc::LineReader lines(input);
+  std::string_view ranges_str;
+  lines.next(ranges_str);
+
+  std::vector<std::pair<long long, long long>> ranges;
+  size_t dash;
+  for (std::string_view range : aoc::split(ranges_str, ',')) {
+    dash = range.find('-');
+    ranges.push_back(
+        {aoc::parse_integer<long long>(range.substr(0, dash)),
+         aoc::parse_integer<long long>(range.substr(dash + 1))});
+  }
+  return ranges;
+}
+
+inline bool contains_twice_repeated_sequence(const long long n) {
+  std::string n_str = std::to_string(n);
+  size_t n_digits = n_str.size();
+  if (n_digits % 2) {
+    return false;
+  }
+  for (size_t i = 0; i < n_digits / 2; ++i) {
+    if (n_str[i] != n_str[n_digits / 2 + i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+inline bool
+contains_repeated_sequence_with_given_length(const std::string n_str,
+                                             const size_t n_digits,
+                                             const size_t period_length) {
+  if(n_digits % period_length != 0){
+    return false;
+  }
+  for (size_t n_period = 1; n_period < n_digits / period_length; ++n_period) {
+    for (size_t i = 0; i < period_length; ++i) {
+      if (n_str[i] != n_str[n_period * period_length + i]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+inline bool contains_repeated_sequence(const long long n) {
+  std::string n_str = std::to_string(n);
+  size_t n_digits = n_str.size();
+
+  for (size_t period_length = 1; period_length <= n_digits / 2;
+       ++period_length) {
+        if(
+          contains_repeated_sequence_with_given_length(n_str, n_digits, period_length)
+        ){
+          return true;
+        }
+  }
+  return false;
+}
+
+inline std::pair<long long, long long>
+process_file(const std::string file_name) {
+  std::vector<std::pair<long long, long long>> ranges = read_ranges(file_name);
+  std::pair<long long, long long> result = {0, 0};
+  for (size_t n_range = 0; n_range < ranges.size(); ++n_range) {
+    for (long long n = ranges[n_range].first; n <= ranges[n_range].second;
+         ++n) {
+      if (contains_repeated_sequence(n)){
+        if (contains_twice_repeated_sequence(n)) {
+          result.first += n;
+        }
+        result.second += n;
+      }
+    }
+  }
+  return result;
+};
+
+// Answers to both parts of the puzzle for the given input.
+inline std::array<std::string, 2> solve(const std::string input_file_name) {
+  std::pair<long long, long long> result = process_file(input_file_name);
+  return {std::to_string(result.first), std::to_string(result.second)};
+}
+
+} // namespace day02
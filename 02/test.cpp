@@ -0,0 +1,56 @@
+#undef NDEBUG
+#include <cassert>
+#include <iostream>
+
+#include "solver.hpp"
+
+using namespace day02;
+
+int main() {
+  std::cout << "Running unit tests ..." << std::endl;
+  std::vector<std::pair<long long, long long>> test_ranges = {
+      {11, 22},
+      {95, 115},
+      {998, 1012},
+      {1188511880, 1188511890},
+      {222220, 222224},
+      {1698522, 1698528},
+      {446443, 446449},
+      {38593856, 38593862},
+      {565653, 565659},
+      {824824821, 824824827},
+      {2121212118, 2121212124}};
+  std::vector<std::pair<long long, long long>> ranges =
+      read_ranges("input_test.txt");
+  for (size_t i = 0; i < test_ranges.size(); ++i) {
+    assert(test_ranges[i].first == ranges[i].first);
+    assert(test_ranges[i].second == ranges[i].second);
+  }
+
+  assert(contains_twice_repeated_sequence(11));
+  assert(contains_twice_repeated_sequence(1010));
+  assert(contains_twice_repeated_sequence(38593859));
+  assert(!contains_twice_repeated_sequence(111));
+
+  assert(contains_repeated_sequence(111));
+  assert(!contains_repeated_sequence(121));
+  assert(contains_repeated_sequence(121212));
+  assert(!contains_repeated_sequence_with_given_length("123412341234", 12, 1));
+  assert(!contains_repeated_sequence_with_given_length("123412341234", 12, 2));
+  assert(!contains_repeated_sequence_with_given_length("123412341234", 12, 3));
+  assert(contains_repeated_sequence_with_given_length("123412341234", 12, 4));
+  assert(!contains_repeated_sequence_with_given_length("123412341234", 12, 5));
+  assert(!contains_repeated_sequence_with_given_length("1231231", 7, 3));
+  assert(!contains_repeated_sequence(1231231));
+
+  std::cout << "\tUnits tests completed successfully." << std::endl;
+
+  std::pair<long long, long long> result;
+  std::cout << "Running AOC test ..." << std::endl;
+  result = process_file("input_test.txt");
+  assert(result.first == 1227775554);
+  assert(result.second == 4174379265);
+  std::cout << "\tAOC test completed successfully." << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,23 @@
+#include "common/bench.hpp"
+#include "solver.hpp"
+
+using namespace day03;
+
+int main(int argc, char *argv[]) {
+  aoc::Benchmark benchmark("03", argc, argv);
+  const std::string input_file_name = benchmark.input_file_name;
+  const Batteries batteries = read_batteries(input_file_name);
+
+  benchmark.add("read_batteries", [&]() {
+    aoc::do_not_optimize(read_batteries(input_file_name));
+  });
+  benchmark.add("maximum_joltage_multiple_batteries", [&]() {
+    aoc::do_not_optimize(maximum_joltage_multiple_batteries(batteries, 12));
+  });
+  benchmark.add("process_file", [&]() {
+    aoc::do_not_optimize(process_file(input_file_name, 2));
+    aoc::do_not_optimize(process_file(input_file_name, 12));
+  });
+
+  return benchmark.run();
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "common/input.hpp"
+#include "common/memory.hpp"
+
+namespace day03 {
+
+using Battery = std::pmr::vector<int>;
+using Batteries = std::pmr::vector<Battery>;
+
+inline long long maximum_joltage_single_battery_n_digits(const Battery &battery, const int n){
+  Battery::const_iterator current_digit = std::max_element(battery.begin(), battery.end()-n+1);
+  long long result = *current_digit;
+  for(int n_digit = 1; n_digit < n; ++n_digit){
+    current_digit = std::max_element(current_digit+1, battery.end()-(n-n_digit-1));
+    result = 10*result + *current_digit;
+  }
+  return result;
+}
+
+inline long long maximum_joltage_multiple_batteries(const Batteries &batteries, const int n){
+  long long result = 0;
+  for(size_t n_battery = 0; n_battery < batteries.size(); ++n_battery){
+    result += maximum_joltage_single_battery_n_digits(batteries[n_battery], n);
+  }
+  return result;
+}
+
+inline Battery parse_battery(const std::string_view battery_string, std::pmr::memory_resource *resource = std::pmr::get_default_resource()){
+  Battery battery(battery_string.size(), resource);
+  for(size_t i = 0; i < battery_string.size(); ++i){
+    battery[i] = battery_string[i] - '0';
+  }
+  return battery;
+}
+
+inline Batteries read_batteries(const std::string input_file_name, std::pmr::memory_resource *resource = std::pmr::get_default_resource()){
+  Batteries batteries(resource);
+  const std::string input = aoc::read_input(input_file_name);
+  aoc::LineReader lines(input);
+  std::string_view battery_string;
+  while(lines.next(battery_string)){
+    batteries.push_back(parse_battery(battery_string, resource));
+  };
+  return batteries;
+}
+
+inline long long process_file(const std::string input_file_name, int n){
+  aoc::Arena arena("03/batteries");
+  return maximum_joltage_multiple_batteries(read_batteries(input_file_name, arena.resource()), n);
+}
+
+// Answers to both parts of the puzzle for the given input.
+inline std::array<std::string, 2> solve(const std::string input_file_name) {
+  aoc::Arena arena("03/batteries");
+  const Batteries batteries = read_batteries(input_file_name, arena.resource());
+  return {std::to_string(maximum_joltage_multiple_batteries(batteries, 2)),
+          std::to_string(maximum_joltage_multiple_batteries(batteries, 12))};
+}
+
+} // namespace day03
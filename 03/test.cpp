@@ -0,0 +1,57 @@
+#undef NDEBUG
+#include <cassert>
+#include <iostream>
+
+#include "solver.hpp"
+
+using namespace day03;
+
+int main() {
+  std::cout << "Running unit tests ..." << std::endl;
+
+  assert(maximum_joltage_single_battery_n_digits({9,8,7,6,5,4,3,2,1,1,1,1,1,1,1}, 1) == 9);
+  assert(maximum_joltage_single_battery_n_digits({9,8,7,6,5,4,3,2,1,1,1,1,1,1,1}, 2) == 98);
+  assert(maximum_joltage_single_battery_n_digits({1,8,7,6,5,4,3,2,1,1,1,1,1,1,9}, 1) == 9);
+  assert(maximum_joltage_single_battery_n_digits({9,8,7,6,5,4,3,2,1,1,1,1,1,1,1}, 3) == 987);
+  assert(maximum_joltage_single_battery_n_digits({8,1,1,1,1,1,1,1,1,1,1,1,1,1,9}, 2) == 89);
+  assert(maximum_joltage_single_battery_n_digits({2,3,4,2,3,4,2,3,4,2,3,4,2,7,8}, 2) == 78);
+  assert(maximum_joltage_single_battery_n_digits({8,1,8,1,8,1,9,1,1,1,1,2,1,1,1}, 2) == 92);
+
+  assert(maximum_joltage_multiple_batteries({
+    {9,8,7,6,5,4,3,2,1,1,1,1,1,1,1},
+    {8,1,1,1,1,1,1,1,1,1,1,1,1,1,9},
+    {2,3,4,2,3,4,2,3,4,2,3,4,2,7,8},
+    {8,1,8,1,8,1,9,1,1,1,1,2,1,1,1}
+  }, 2) == 357);
+
+  Battery battery = parse_battery("0123");
+  for(int i = 0; i < 4; ++i){
+    assert(battery[i] == i);
+  }
+
+  std::cout << "\tUnits tests completed successfully." << std::endl;
+
+  std::cout << "Running AOC test ..." << std::endl;
+
+  std::vector<std::vector<int>> batteries_ref = {
+    {9,8,7,6,5,4,3,2,1,1,1,1,1,1,1},
+    {8,1,1,1,1,1,1,1,1,1,1,1,1,1,9},
+    {2,3,4,2,3,4,2,3,4,2,3,4,2,7,8},
+    {8,1,8,1,8,1,9,1,1,1,1,2,1,1,1}
+  };
+  Batteries batteries = read_batteries("input_test.txt");
+  assert(batteries.size() == 4);
+  assert(batteries.size() == 4);
+  for(size_t n_battery = 0; n_battery < batteries_ref.size(); ++n_battery){
+    assert(batteries[n_battery].size() == 15);
+    for(size_t n_digit = 0; n_digit < batteries_ref[n_battery].size(); ++n_digit){
+      assert(batteries[n_battery][n_digit] == batteries_ref[n_battery][n_digit]);
+    }
+  }
+  assert(process_file("input_test.txt", 2) == 357);
+  assert(process_file("input_test.txt", 12) == 3121910778619);
+
+  std::cout << "\tAOC test completed successfully." << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,21 @@
+#include "common/bench.hpp"
+#include "solver.hpp"
+
+using namespace day04;
+
+int main(int argc, char *argv[]) {
+  aoc::Benchmark benchmark("04", argc, argv);
+  const std::string input_file_name = benchmark.input_file_name;
+  const Grid grid = read_grid(input_file_name);
+
+  benchmark.add("read_grid", [&]() {
+    aoc::do_not_optimize(read_grid(input_file_name));
+  });
+  benchmark.add("analyze_grid",
+                [&]() { aoc::do_not_optimize(analyze_grid(grid, 1)); });
+  benchmark.add("process_file", [&]() {
+    aoc::do_not_optimize(process_file(input_file_name));
+  });
+
+  return benchmark.run();
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iostream>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "common/input.hpp"
+#include "common/instrument.hpp"
+#include "common/memory.hpp"
+
+namespace day04 {
+
+using Grid = std::pmr::vector<std::pmr::vector<int>>;
+
+inline int sum_within_radius(const Grid &grid, const int n_x, const int n_y,
+                             const int radius, bool count_self = false) {
+  int sum = 0;
+  for (int x_pos = std::max(n_x - radius, 0);
+       x_pos <= std::min(n_x + radius, (int)grid[n_y].size() - 1); ++x_pos) {
+    for (int y_pos = std::max(n_y - radius, 0);
+         y_pos <= std::min(n_y + radius, (int)grid.size() - 1); ++y_pos) {
+      sum += grid[y_pos][x_pos];
+    }
+  }
+  if (!count_self) {
+    return sum - grid[n_y][n_x];
+  }
+  return sum;
+}
+
+inline Grid analyze_grid(
+    const Grid &grid, const int radius,
+    std::pmr::memory_resource *resource = std::pmr::get_default_resource()) {
+  Grid result(resource);
+  result.reserve(grid.size());
+  for (size_t i = 0; i < grid.size(); ++i) {
+    result.emplace_back(grid[i].size(), 0);
+  }
+  for (int n_y = 0; n_y < grid.size(); ++n_y) {
+    for (int n_x = 0; n_x < grid[n_y].size(); ++n_x) {
+      result[n_y][n_x] = sum_within_radius(grid, n_x, n_y, radius);
+    }
+  }
+  return result;
+}
+
+inline int count_grid(const Grid &grid, const Grid &analyzed_grid,
+                      const int max_score) {
+  int count = 0;
+  for (int n_y = 0; n_y < grid.size(); ++n_y) {
+    for (int n_x = 0; n_x < grid[n_y].size(); ++n_x) {
+      if (grid[n_y][n_x] == 1 && analyzed_grid[n_y][n_x] < max_score) {
+        ++count;
+      }
+    }
+  }
+  return count;
+}
+
+inline std::pmr::vector<int> parse_line(
+    const std::string_view line,
+    std::pmr::memory_resource *resource = std::pmr::get_default_resource()) {
+  std::pmr::vector<int> result(line.size(), 0, resource);
+  for (int n_c = 0; n_c < line.size(); ++n_c) {
+    if (line[n_c] == '@') {
+      result[n_c] = 1;
+    }
+  }
+  return result;
+}
+
+inline Grid read_grid(
+    const std::string input_file_name,
+    std::pmr::memory_resource *resource = std::pmr::get_default_resource()) {
+  AOC_PHASE("04/read_grid");
+  Grid result(resource);
+  const std::string input = aoc::read_input(input_file_name);
+  aoc::LineReader lines(input);
+  std::string_view line;
+  while (lines.next(line)) {
+    result.push_back(parse_line(line, resource));
+  }
+  return result;
+}
+
+inline bool update_grid(Grid &grid, const Grid &analyzed_grid,
+                        const int max_score) {
+  bool grid_updated = false;
+  for (size_t n_line = 0; n_line < grid.size(); ++n_line) {
+    for (size_t n_column = 0; n_column < grid[n_line].size(); ++n_column) {
+      if (grid[n_line][n_column] == 1 &&
+          analyzed_grid[n_line][n_column] < max_score) {
+        grid[n_line][n_column] = 0;
+        grid_updated = true;
+      }
+    }
+  }
+  return grid_updated;
+}
+
+// The grid lives in an arena for the whole run. Every iteration replaces the
+// analyzed grid with one of the same shape, so its rows come from a pool that
+// recycles the rows of the previous iteration.
+inline std::vector<int> process_file(const std::string input_file_name) {
+  aoc::Arena arena("04/grid");
+  aoc::Pool pool("04/analyzed_grid");
+  Grid grid = read_grid(input_file_name, arena.resource());
+  int score = 0;
+  std::vector<int> result;
+  Grid analyzed_grid(pool.resource());
+  bool grid_updated = true;
+  while (grid_updated) {
+    AOC_PHASE("04/iteration");
+    AOC_COUNT("04/iterations");
+    analyzed_grid = analyze_grid(grid, 1, pool.resource());
+    score += count_grid(grid, analyzed_grid, 4);
+    result.push_back(score);
+    grid_updated = update_grid(grid, analyzed_grid, 4);
+  }
+  return result;
+}
+
+// Answers to both parts of the puzzle for the given input.
+inline std::array<std::string, 2> solve(const std::string input_file_name) {
+  std::vector<int> result = process_file(input_file_name);
+  return {std::to_string(result[0]),
+          std::to_string(result[result.size() - 1])};
+}
+
+} // namespace day04
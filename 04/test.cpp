@@ -0,0 +1,93 @@
+#undef NDEBUG
+#include <cassert>
+#include <iostream>
+
+#include "solver.hpp"
+
+using namespace day04;
+
+int main() {
+  std::cout << "Running unit tests ..." << std::endl;
+
+  assert(sum_within_radius({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}, 0, 0, 0) == 0);
+  assert(sum_within_radius({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}, 0, 0, 0, true) ==
+         1);
+  assert(sum_within_radius({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}, 0, 0, 1) == 11);
+  assert(sum_within_radius({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}, 1, 0, 1) == 19);
+  assert(sum_within_radius({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}, 0, 1, 1) == 23);
+  assert(sum_within_radius({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}, 0, 0, 2) == 44);
+  assert(sum_within_radius({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}, 1, 1, 2) == 40);
+
+  assert(sum_within_radius({{1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}}, 0, 0,
+                           0) == 0);
+  assert(sum_within_radius({{1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}}, 0, 0,
+                           1) == 9);
+  assert(sum_within_radius({{1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}}, 0, 0,
+                           2) == 20);
+  assert(sum_within_radius({{1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}}, 0, 2,
+                           1) == 28);
+
+  Grid result =
+      analyze_grid({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}, 1);
+  assert(result[0][0] == 11);
+  assert(result[1][0] == 23);
+  assert(result[0][1] == 19);
+
+  std::pmr::vector<int> parsed_line = parse_line("..@@.@@@@.");
+  assert(parsed_line.size() == 10);
+  assert(parsed_line[0] == 0);
+  assert(parsed_line[1] == 0);
+  assert(parsed_line[2] == 1);
+  assert(parsed_line[3] == 1);
+  assert(parsed_line[4] == 0);
+  assert(parsed_line[5] == 1);
+  assert(parsed_line[6] == 1);
+  assert(parsed_line[7] == 1);
+  assert(parsed_line[8] == 1);
+  assert(parsed_line[9] == 0);
+
+  std::cout << "\tUnits tests completed successfully." << std::endl;
+
+  std::cout << "Running AOC test ..." << std::endl;
+
+  Grid example_grid = {
+      {0, 0, 1, 1, 0, 1, 1, 1, 1, 0}, {1, 1, 1, 0, 1, 0, 1, 0, 1, 1},
+      {1, 1, 1, 1, 1, 0, 1, 0, 1, 1}, {1, 0, 1, 1, 1, 1, 0, 0, 1, 0},
+      {1, 1, 0, 1, 1, 1, 1, 0, 1, 1}, {0, 1, 1, 1, 1, 1, 1, 1, 0, 1},
+      {0, 1, 0, 1, 0, 1, 0, 1, 1, 1}, {1, 0, 1, 1, 1, 0, 1, 1, 1, 1},
+      {0, 1, 1, 1, 1, 1, 1, 1, 1, 0}, {1, 0, 1, 0, 1, 1, 1, 0, 1, 0}};
+
+  Grid example_grid_analysis =
+      analyze_grid(example_grid, 1);
+  assert(example_grid_analysis[0][0] == 2);
+  assert(example_grid_analysis[0][1] == 4);
+  assert(example_grid_analysis[0][2] == 3);
+  assert(count_grid(example_grid, analyze_grid(example_grid, 1), 4) == 13);
+
+  Grid example_grid_read_from_file =
+      read_grid("input_test.txt");
+  for (size_t i = 0; i < example_grid.size(); ++i) {
+    for (size_t j = 0; j < example_grid.size(); ++j) {
+      assert(example_grid[i][j] == example_grid_read_from_file[i][j]);
+    }
+  }
+  std::vector<int> example_result = process_file("input_test.txt");
+  assert(example_result[0] == 13);
+  assert(example_result[example_result.size() - 1] == 43);
+
+  Grid updated_example_grid_example = {
+      {0, 0, 0, 0, 0, 0, 0, 1, 0, 0}, {0, 1, 1, 0, 1, 0, 1, 0, 1, 1},
+      {1, 1, 1, 1, 1, 0, 0, 0, 1, 1}, {1, 0, 1, 1, 1, 1, 0, 0, 1, 0},
+      {0, 1, 0, 1, 1, 1, 1, 0, 1, 0}, {0, 1, 1, 1, 1, 1, 1, 1, 0, 1},
+      {0, 1, 0, 1, 0, 1, 0, 1, 1, 1}, {0, 0, 1, 1, 1, 0, 1, 1, 1, 1},
+      {0, 1, 1, 1, 1, 1, 1, 1, 1, 0}, {0, 0, 0, 0, 1, 1, 1, 0, 0, 0}};
+  assert(update_grid(example_grid, example_grid_analysis, 4));
+  for (size_t i = 0; i < updated_example_grid_example.size(); ++i) {
+    for (size_t j = 0; j < updated_example_grid_example.size(); ++j) {
+      assert(example_grid[i][j] == updated_example_grid_example[i][j]);
+    }
+  }
+  std::cout << "\tAOC test completed successfully." << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,25 @@
+#include "common/bench.hpp"
+#include "solver.hpp"
+
+using namespace day05;
+
+int main(int argc, char *argv[]) {
+  aoc::Benchmark benchmark("05", argc, argv);
+  const std::string input_file_name = benchmark.input_file_name;
+  const auto [ids, id_ranges] = read_ids_and_id_ranges(input_file_name);
+
+  benchmark.add("read_ids_and_id_ranges", [&]() {
+    aoc::do_not_optimize(read_ids_and_id_ranges(input_file_name));
+  });
+  benchmark.add("count_fresh_ingredients", [&]() {
+    aoc::do_not_optimize(count_fresh_ingredients(ids, id_ranges));
+  });
+  benchmark.add("length_of_id_ranges", [&]() {
+    aoc::do_not_optimize(length_of_id_ranges(id_ranges));
+  });
+  benchmark.add("process_file", [&]() {
+    aoc::do_not_optimize(process_file(input_file_name));
+  });
+
+  return benchmark.run();
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <memory_resource>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/input.hpp"
+#include "common/memory.hpp"
+
+namespace day05 {
+
+using Ids = std::pmr::vector<long long>;
+using IdRanges = std::pmr::vector<std::pair<long long, long long>>;
+
+inline bool ingredient_is_fresh(const long long id,
+                                const IdRanges &id_ranges) {
+  for (auto id_range : id_ranges) {
+    if (id >= id_range.first && id <= id_range.second) {
+      return true;
+    }
+  }
+  return false;
+}
+
+inline int count_fresh_ingredients(const Ids &ids, const IdRanges &id_ranges) {
+  int count = 0;
+  for (auto id : ids) {
+    if (ingredient_is_fresh(id, id_ranges)) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+inline std::pair<Ids, IdRanges> read_ids_and_id_ranges(
+    const std::string input_file_name,
+    std::pmr::memory_resource *resource = std::pmr::get_default_resource()) {
+  const std::string input = aoc::read_input(input_file_name);
+  aoc::LineReader lines(input);
+  std::string_view line;
+  Ids ids(resource);
+  IdRanges id_ranges(resource);
+
+  size_t separator;
+
+  while (lines.next(line)) {
+    if (line.empty()) {
+      continue;
+    }
+    separator = line.find('-');
+    if (separator == std::string_view::npos) {
+      ids.push_back(aoc::parse_integer<long long>(line));
+    } else {
+      id_ranges.push_back(
+          {aoc::parse_integer<long long>(line.substr(0, separator)),
+           aoc::parse_integer<long long>(line.substr(separator + 1))});
+    }
+  }
+
+  return {std::move(ids), std::move(id_ranges)};
+}
+
+inline IdRanges unique_ranges(IdRanges id_ranges) {
+  IdRanges unique_ranges(id_ranges.get_allocator());
+  std::sort(id_ranges.begin(), id_ranges.end());
+  long long current_lower_limit = id_ranges[0].first;
+  long long current_upper_limit = id_ranges[0].second;
+  for (size_t i = 1; i < id_ranges.size(); ++i) {
+    if (id_ranges[i].first <= current_upper_limit) {
+      if (id_ranges[i].second > current_upper_limit) {
+        current_upper_limit = id_ranges[i].second;
+      }
+    } else {
+      unique_ranges.push_back({current_lower_limit, current_upper_limit});
+      current_lower_limit = id_ranges[i].first;
+      current_upper_limit = id_ranges[i].second;
+    }
+  }
+  if (current_lower_limit > unique_ranges.back().second) {
+    unique_ranges.push_back({current_lower_limit, current_upper_limit});
+  } else if (id_ranges.back().first > unique_ranges.back().second) {
+    unique_ranges.push_back(id_ranges.back());
+  }
+  return unique_ranges;
+}
+
+inline long long length_of_id_ranges(const IdRanges &id_ranges) {
+  long long length = 0;
+  for (auto id_range : id_ranges) {
+    length += id_range.second - id_range.first + 1;
+  }
+  return length;
+}
+
+inline std::pair<int, long long>
+process_file(const std::string input_file_name) {
+  aoc::Arena arena("05/ids_and_id_ranges");
+  std::pair<Ids, IdRanges> ids_and_id_ranges =
+      read_ids_and_id_ranges(input_file_name, arena.resource());
+  const int n_fresh = count_fresh_ingredients(ids_and_id_ranges.first,
+                                              ids_and_id_ranges.second);
+  return {n_fresh, length_of_id_ranges(
+                       unique_ranges(std::move(ids_and_id_ranges.second)))};
+}
+
+// Answers to both parts of the puzzle for the given input.
+inline std::array<std::string, 2> solve(const std::string input_file_name) {
+  std::pair<int, long long> result = process_file(input_file_name);
+  return {std::to_string(result.first), std::to_string(result.second)};
+}
+
+} // namespace day05
@@ -0,0 +1,55 @@
+#undef NDEBUG
+#include <cassert>
+#include <iostream>
+
+#include "solver.hpp"
+
+using namespace day05;
+
+int main() {
+  std::cout << "Running unit tests ..." << std::endl;
+
+  assert(!ingredient_is_fresh(5, {{1, 3}}));
+  assert(ingredient_is_fresh(5, {{5, 5}}));
+  assert(ingredient_is_fresh(5, {{1, 3}, {5, 7}}));
+  assert(ingredient_is_fresh(5, {{1, 3}, {2, 5}}));
+
+  assert(count_fresh_ingredients({1, 2, 3, 4, 5}, {{1, 3}, {2, 5}}) == 5);
+  assert(count_fresh_ingredients({1, 2, 3, 4, 5}, {{1, 3}, {5, 5}}) == 4);
+
+  IdRanges ur{{1, 5}, {15, 20}};
+  assert(unique_ranges({{15, 20}, {1, 5}}) == ur);
+  assert(unique_ranges({{1, 5}, {15, 20}}) == ur);
+  assert(unique_ranges({{1, 5}, {1, 5}, {15, 20}}) == ur);
+  assert(unique_ranges({{1, 2}, {2, 4}, {5, 5}, {15, 20}}) != ur);
+
+  assert(length_of_id_ranges({{1, 5}, {15, 20}}) == 11);
+  assert(length_of_id_ranges(unique_ranges({{1, 5}, {1, 5}, {15, 20}})) == 11);
+  assert(length_of_id_ranges(
+             unique_ranges({{1, 2}, {2, 4}, {5, 5}, {15, 20}})) == 11);
+
+  std::cout << "\tUnits tests completed successfully." << std::endl;
+
+  std::cout << "Running AOC test ..." << std::endl;
+
+  Ids example_ids = {1, 5, 8, 11, 17, 32};
+  IdRanges example_id_ranges = {
+      {3, 5}, {10, 14}, {16, 20}, {12, 18}};
+  assert(count_fresh_ingredients(example_ids, example_id_ranges) == 3);
+  IdRanges example_id_ranges_unique = {{3, 5}, {10, 20}};
+  assert(unique_ranges(example_id_ranges) == example_id_ranges_unique);
+  assert(length_of_id_ranges(unique_ranges(example_id_ranges)) == 14);
+
+  std::pair<Ids, IdRanges> ids_and_id_ranges =
+      read_ids_and_id_ranges("input_test.txt");
+  assert(ids_and_id_ranges.first == example_ids);
+  assert(ids_and_id_ranges.second == example_id_ranges);
+
+  std::pair<int, long long> example_result = process_file("input_test.txt");
+  assert(example_result.first == 3);
+  assert(example_result.second == 14);
+
+  std::cout << "\tAOC test completed successfully." << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,18 @@
+#include "common/bench.hpp"
+#include "solver.hpp"
+
+using namespace day06;
+
+int main(int argc, char *argv[]) {
+  aoc::Benchmark benchmark("06", argc, argv);
+  const std::string input_file_name = benchmark.input_file_name;
+
+  benchmark.add("process_file", [&]() {
+    aoc::do_not_optimize(process_file(input_file_name));
+  });
+  benchmark.add("process_file_streaming", [&]() {
+    aoc::do_not_optimize(process_file_streaming(input_file_name, 4096));
+  });
+
+  return benchmark.run();
+}
@@ -0,0 +1,333 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/input.hpp"
+
+namespace day06 {
+
+struct InputFile {
+  int n_columns;
+  int n_rows;
+  int n_terms;
+  std::string input_file_name;
+  std::string content;
+  std::vector<std::vector<char>> raw_input;
+  std::vector<int> operators;
+  std::vector<std::pair<int, int>> columns;
+
+  InputFile(const std::string input_file_name)
+      : input_file_name(input_file_name) {}
+
+  void analyze() {
+    n_rows = 1;
+    content = aoc::read_input(input_file_name);
+    aoc::LineReader lines(content);
+    std::string_view line;
+    lines.next(line);
+    n_columns = line.size();
+    while (lines.next(line)) {
+      n_rows++;
+    }
+  }
+
+  void initialize() {
+    for (int i = 0; i < n_rows; ++i) {
+      raw_input.push_back(std::vector<char>(n_columns, ' '));
+    }
+  }
+
+  void read() {
+    initialize();
+    aoc::LineReader lines(content);
+    std::string_view line;
+    for (int n_row = 0; n_row < n_rows; ++n_row) {
+      lines.next(line);
+      for (int n_col = 0; n_col < std::min<int>(n_columns, line.size());
+           ++n_col) {
+        raw_input[n_row][n_col] = line[n_col];
+      }
+    }
+  }
+
+  void parse_operators() {
+    for (int n_col = 0; n_col < n_columns; ++n_col) {
+      if (raw_input.back()[n_col] == '+') {
+        operators.push_back(0);
+      }
+      if (raw_input.back()[n_col] == '*') {
+        operators.push_back(1);
+      }
+    }
+    n_terms = operators.size();
+  };
+
+  void find_table_columns() {
+    bool is_column;
+    columns.push_back(std::pair<int, int>{0, 0});
+    for (int n_col = 0; n_col < n_columns - 1; ++n_col) {
+      is_column = true;
+      for (int n_row = 0; n_row < n_rows - 1; ++n_row) {
+        if (raw_input[n_row][n_col] != ' ') {
+          is_column = false;
+          break;
+        }
+      }
+      if (is_column) {
+        columns.back().second = n_col - 1;
+        columns.push_back(std::pair<int, int>{n_col + 1, n_columns - 1});
+      }
+    }
+  }
+
+  std::vector<long long> parse_column_lr(int n_column) {
+    std::vector<long long> result(n_rows - 1, 0ll);
+    std::string number;
+    for (int n_row = 0; n_row < n_rows - 1; ++n_row) {
+      number.clear();
+      for (int n_col = columns[n_column].first;
+           n_col <= columns[n_column].second; ++n_col) {
+        if (raw_input[n_row][n_col] != ' ') {
+          number += raw_input[n_row][n_col];
+        }
+      }
+      result[n_row] = aoc::parse_integer<long long>(number);
+    }
+    return result;
+  }
+
+  std::vector<long long> parse_column_tb(int n_column) {
+    std::vector<long long> result(
+        columns[n_column].second - columns[n_column].first + 1, 0ll);
+    std::string number;
+    for (int n_col = columns[n_column].first; n_col <= columns[n_column].second;
+         ++n_col) {
+      number.clear();
+      for (int n_row = 0; n_row < n_rows - 1; ++n_row) {
+        if (raw_input[n_row][n_col] != ' ') {
+          number += raw_input[n_row][n_col];
+        }
+      }
+      result[n_col - columns[n_column].first] =
+          aoc::parse_integer<long long>(number);
+    }
+    return result;
+  }
+
+  long long calculate_result(bool lr) {
+    long long result = 0ll;
+    std::vector<long long> numbers;
+    for (int n_term = 0; n_term < n_terms; ++n_term) {
+      if (lr) {
+        numbers = parse_column_lr(n_term);
+      } else {
+        numbers = parse_column_tb(n_term);
+      }
+      if (operators[n_term] == 0) {
+        result += std::accumulate(numbers.begin(), numbers.end(), 0ll);
+      } else {
+        result += std::accumulate(numbers.begin(), numbers.end(), 1ll,
+                                  std::multiplies<long long>());
+      }
+    }
+    return result;
+  }
+};
+
+inline std::pair<long long, long long>
+process_file(const std::string input_file_name) {
+  InputFile input_file(input_file_name);
+  input_file.analyze();
+  input_file.read();
+  input_file.parse_operators();
+  input_file.find_table_columns();
+  return {input_file.calculate_result(true),
+          input_file.calculate_result(false)};
+}
+
+struct WorksheetStream {
+  std::streamoff n_columns;
+  int n_rows;
+  std::streamoff strip_width;
+  std::string input_file_name;
+  std::vector<std::streamoff> row_offsets;
+  std::vector<std::streamoff> row_lengths;
+  std::vector<std::vector<char>> strip;
+
+  WorksheetStream(const std::string input_file_name,
+                  const std::streamoff strip_width)
+      : strip_width(strip_width), input_file_name(input_file_name) {
+    if (strip_width <= 0) {
+      throw std::invalid_argument(
+          "Expected a positive strip width instead of " +
+          std::to_string(strip_width));
+    }
+  }
+
+  // Like aoc::LineReader, a '\r' before the end of a row is not part of it.
+  void analyze() {
+    n_columns = 0;
+    std::ifstream file(input_file_name, std::ios::binary);
+    std::streamoff offset = 0;
+    std::streamsize n_chars;
+    std::streamoff row_length;
+    while (file.peek() != std::ifstream::traits_type::eof()) {
+      row_offsets.push_back(offset);
+      file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+      n_chars = file.gcount();
+      row_length = file.eof() ? n_chars : n_chars - 1;
+      if (row_length > 0) {
+        file.clear();
+        file.seekg(offset + row_length - 1);
+        if (file.peek() == '\r') {
+          --row_length;
+        }
+      }
+      offset += n_chars;
+      file.clear();
+      file.seekg(offset);
+      row_lengths.push_back(row_length);
+      n_columns = std::max(n_columns, row_length);
+    }
+    while (!row_lengths.empty() && row_lengths.back() == 0) {
+      row_offsets.pop_back();
+      row_lengths.pop_back();
+    }
+    n_rows = row_lengths.size();
+  }
+
+  void load_strip(std::ifstream &file, const std::streamoff start,
+                  const std::streamoff width) {
+    strip.resize(n_rows);
+    for (int n_row = 0; n_row < n_rows; ++n_row) {
+      strip[n_row].assign(width, ' ');
+      if (start < row_lengths[n_row]) {
+        file.clear();
+        file.seekg(row_offsets[n_row] + start);
+        file.read(strip[n_row].data(),
+                  std::min(width, row_lengths[n_row] - start));
+      }
+    }
+  }
+
+  bool is_separator(const std::streamoff n_col) {
+    for (int n_row = 0; n_row < n_rows - 1; ++n_row) {
+      if (strip[n_row][n_col] != ' ') {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::pair<long long, long long> calculate_problem(const std::streamoff first,
+                                                    const std::streamoff last) {
+    char op = ' ';
+    for (std::streamoff n_col = first; n_col <= last; ++n_col) {
+      if (strip.back()[n_col] != ' ') {
+        op = strip.back()[n_col];
+        break;
+      }
+    }
+    std::pair<long long, long long> result =
+        op == '*' ? std::pair<long long, long long>{1ll, 1ll}
+                  : std::pair<long long, long long>{0ll, 0ll};
+    long long number;
+    bool has_digits;
+    for (int n_row = 0; n_row < n_rows - 1; ++n_row) {
+      number = 0ll;
+      has_digits = false;
+      for (std::streamoff n_col = first; n_col <= last; ++n_col) {
+        if (strip[n_row][n_col] != ' ') {
+          number = 10 * number + (strip[n_row][n_col] - '0');
+          has_digits = true;
+        }
+      }
+      if (has_digits) {
+        result.first =
+            op == '*' ? result.first * number : result.first + number;
+      }
+    }
+    for (std::streamoff n_col = first; n_col <= last; ++n_col) {
+      number = 0ll;
+      has_digits = false;
+      for (int n_row = 0; n_row < n_rows - 1; ++n_row) {
+        if (strip[n_row][n_col] != ' ') {
+          number = 10 * number + (strip[n_row][n_col] - '0');
+          has_digits = true;
+        }
+      }
+      if (has_digits) {
+        result.second =
+            op == '*' ? result.second * number : result.second + number;
+      }
+    }
+    return result;
+  }
+
+  // Processes the sheet in vertical strips that end at a separator column.
+  // If a single problem is wider than the strip, the strip is widened until
+  // it fits.
+  std::pair<long long, long long> calculate_result() {
+    std::pair<long long, long long> result{0ll, 0ll};
+    std::pair<long long, long long> problem_result;
+    std::ifstream file(input_file_name, std::ios::binary);
+    std::streamoff start = 0;
+    std::streamoff width, end, first;
+    while (start < n_columns) {
+      width = strip_width;
+      while (true) {
+        load_strip(file, start, width);
+        if (start + width >= n_columns) {
+          end = n_columns - start;
+          break;
+        }
+        end = width - 1;
+        while (end >= 0 && !is_separator(end)) {
+          --end;
+        }
+        if (end >= 0) {
+          break;
+        }
+        width *= 2;
+      }
+      first = 0;
+      for (std::streamoff n_col = 0; n_col <= end; ++n_col) {
+        if (n_col == end || is_separator(n_col)) {
+          if (n_col > first) {
+            problem_result = calculate_problem(first, n_col - 1);
+            result.first += problem_result.first;
+            result.second += problem_result.second;
+          }
+          first = n_col + 1;
+        }
+      }
+      start += end + 1;
+    }
+    return result;
+  }
+};
+
+inline std::pair<long long, long long>
+process_file_streaming(const std::string input_file_name,
+                       const std::streamoff strip_width) {
+  WorksheetStream worksheet_stream(input_file_name, strip_width);
+  worksheet_stream.analyze();
+  return worksheet_stream.calculate_result();
+}
+
+// Answers to both parts of the puzzle for the given input.
+inline std::array<std::string, 2> solve(const std::string input_file_name) {
+  std::pair<long long, long long> result = process_file(input_file_name);
+  return {std::to_string(result.first), std::to_string(result.second)};
+}
+
+} // namespace day06
@@ -0,0 +1,104 @@
+#undef NDEBUG
+#include <cassert>
+#include <filesystem>
+#include <iostream>
+
+#include "solver.hpp"
+
+using namespace day06;
+
+int main() {
+  std::cout << "Running unit tests ..." << std::endl;
+
+  InputFile input_file("input_test.txt");
+  input_file.analyze();
+  assert(input_file.n_columns == 15);
+  assert(input_file.n_rows == 4);
+
+  input_file.read();
+  std::vector<char> input_file_first_line{'1', '2', '3', ' ', '3',
+                                          '2', '8', ' ', ' ', '5',
+                                          '1', ' ', '6', '4', ' '};
+  std::vector<char> input_file_operator_line{'*', ' ', ' ', ' ', '+',
+                                             ' ', ' ', ' ', '*', ' ',
+                                             ' ', ' ', '+', ' ', ' '};
+  assert(input_file.raw_input[0] == input_file_first_line);
+  assert(input_file.raw_input.back() == input_file_operator_line);
+
+  std::vector<int> example_operators = {1, 0, 1, 0};
+  input_file.parse_operators();
+  assert(input_file.n_terms == 4);
+  assert(input_file.operators == example_operators);
+
+  std::vector<std::pair<int, int>> example_columns{
+      {0, 2}, {4, 6}, {8, 10}, {12, 14}};
+  input_file.find_table_columns();
+  assert(input_file.columns == example_columns);
+
+  std::vector<long long> first_problem_numbers = {123, 45, 6};
+  std::vector<long long> first_problem_numbers_2 = {1, 24, 356};
+
+  assert(input_file.parse_column_lr(0) == first_problem_numbers);
+  assert(input_file.parse_column_tb(0) == first_problem_numbers_2);
+
+  WorksheetStream worksheet_stream("input_test.txt", 4);
+  worksheet_stream.analyze();
+  assert(worksheet_stream.n_columns == 15);
+  assert(worksheet_stream.n_rows == 4);
+  std::vector<std::streamoff> example_row_offsets{0, 16, 32, 48};
+  assert(worksheet_stream.row_offsets == example_row_offsets);
+
+  std::ifstream worksheet_file("input_test.txt", std::ios::binary);
+  worksheet_stream.load_strip(worksheet_file, 0, 4);
+  assert(worksheet_stream.is_separator(3));
+  assert(!worksheet_stream.is_separator(2));
+
+  std::cout << "\tUnits tests completed successfully." << std::endl;
+
+  std::cout << "Running AOC test ..." << std::endl;
+
+  assert(input_file.calculate_result(true) == 4277556);
+  assert(input_file.calculate_result(false) == 3263827);
+
+  std::pair<long long, long long> example_result =
+      process_file("input_test.txt");
+  assert(example_result.first == 4277556);
+  assert(example_result.second == 3263827);
+
+  for (int strip_width : {1, 2, 3, 4, 5, 8, 15, 64}) {
+    assert(process_file_streaming("input_test.txt", strip_width) ==
+           example_result);
+  }
+
+  // Both readers have to give the same results for CRLF line endings.
+  const std::string crlf_file_name =
+      (std::filesystem::temp_directory_path() / "aoc_06_input_test_crlf.txt")
+          .string();
+  std::ifstream lf_file("input_test.txt", std::ios::binary);
+  std::ofstream crlf_file(crlf_file_name, std::ios::binary);
+  std::string line;
+  while (std::getline(lf_file, line)) {
+    crlf_file << line << "\r\n";
+  }
+  crlf_file.close();
+  assert(process_file(crlf_file_name) == example_result);
+  for (int strip_width : {1, 4, 64}) {
+    assert(process_file_streaming(crlf_file_name, strip_width) ==
+           example_result);
+  }
+  std::filesystem::remove(crlf_file_name);
+
+  for (int strip_width : {0, -1}) {
+    bool invalid_width = false;
+    try {
+      process_file_streaming("input_test.txt", strip_width);
+    } catch (const std::invalid_argument &) {
+      invalid_width = true;
+    }
+    assert(invalid_width);
+  }
+
+  std::cout << "\tAOC test completed successfully." << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,30 @@
+#include "common/bench.hpp"
+#include "solver.hpp"
+
+using namespace day07;
+
+int main(int argc, char *argv[]) {
+  aoc::Benchmark benchmark("07", argc, argv);
+  const std::string input_file_name = benchmark.input_file_name;
+  const std::vector<std::vector<int>> input = read_file(input_file_name);
+
+  benchmark.add("read_file", [&]() {
+    aoc::do_not_optimize(read_file(input_file_name));
+  });
+  benchmark.add("propagate",
+                [&]() { aoc::do_not_optimize(propagate(input)); });
+  benchmark.add("propagate_bitwise",
+                [&]() { aoc::do_not_optimize(propagate_bitwise(input)); });
+  benchmark.add("count_timelines",
+                [&]() { aoc::do_not_optimize(count_timelines(input)); });
+  benchmark.add("propagate_all_sources",
+                [&]() { aoc::do_not_optimize(propagate_all_sources(input)); });
+  benchmark.add("process_file", [&]() {
+    aoc::do_not_optimize(process_file(input_file_name));
+  });
+  benchmark.add("process_file_streaming", [&]() {
+    aoc::do_not_optimize(process_file_streaming(input_file_name));
+  });
+
+  return benchmark.run();
+}
@@ -0,0 +1,398 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "common/input.hpp"
+
+namespace day07 {
+
+inline int perform_step(std::vector<int> &state,
+                        const std::vector<int> &transform) {
+  int n_splits = 0;
+  for (size_t i = 0; i < transform.size(); ++i) {
+    if (transform[i] == 1) {
+      if (state[i] == 1) {
+        if (i > 0) {
+          state[i - 1] = 1;
+        }
+        state[i] = 0;
+        if (i < state.size() - 1) {
+          state[i + 1] = 1;
+        }
+        ++n_splits;
+      }
+    }
+  }
+  return n_splits;
+}
+
+inline std::vector<std::vector<int>>
+read_file(const std::string input_file_name) {
+  const std::string input = aoc::read_input(input_file_name);
+  aoc::LineReader lines(input);
+  std::string_view line;
+  std::vector<std::vector<int>> result;
+  lines.next(line);
+  result.push_back(std::vector<int>(line.size(), 0));
+  for (size_t i = 0; i < line.size(); ++i) {
+    if (line[i] == 'S') {
+      result[0][i] = 1;
+    }
+  }
+  while (lines.next(line)) {
+    result.push_back(std::vector<int>(line.size(), 0));
+    for (size_t i = 0; i < line.size(); ++i) {
+      if (line[i] == '^') {
+        result.back()[i] = 1;
+      }
+    }
+  }
+
+  return result;
+}
+
+inline int propagate(
+  const std::vector<std::vector<int>> &input
+){
+  int n_splits = 0;
+  std::vector<int> state = input[0];
+  for(size_t i = 1; i < input.size(); ++i){
+    n_splits += perform_step(state, input[i]);
+  }
+  return n_splits;
+}
+
+inline std::vector<std::uint64_t> pack_row(const std::vector<int> &row) {
+  std::vector<std::uint64_t> result((row.size() + 63) / 64, 0);
+  for (size_t i = 0; i < row.size(); ++i) {
+    if (row[i] == 1) {
+      result[i / 64] |= std::uint64_t{1} << (i % 64);
+    }
+  }
+  return result;
+}
+
+inline std::vector<int> unpack_row(const std::vector<std::uint64_t> &row,
+                                   const size_t width) {
+  std::vector<int> result(width, 0);
+  for (size_t i = 0; i < width; ++i) {
+    result[i] = (row[i / 64] >> (i % 64)) & 1;
+  }
+  return result;
+}
+
+// Same as perform_step, but for 64 columns per word: beams that hit a splitter
+// are removed and reappear in both neighboring columns.
+inline int perform_step_bitwise(std::vector<std::uint64_t> &state,
+                                const std::vector<std::uint64_t> &splitters,
+                                const size_t width) {
+  int n_splits = 0;
+  std::uint64_t hit, previous_hit = 0, next_hit;
+  std::uint64_t current_hit = state.empty() ? 0 : state[0] & splitters[0];
+  for (size_t i = 0; i < state.size(); ++i) {
+    hit = current_hit;
+    next_hit = i + 1 < state.size() ? state[i + 1] & splitters[i + 1] : 0;
+    n_splits += std::popcount(hit);
+    state[i] = (state[i] & ~splitters[i]) | (hit << 1) | (previous_hit >> 63) |
+               (hit >> 1) | (next_hit << 63);
+    previous_hit = hit;
+    current_hit = next_hit;
+  }
+  if (width % 64 != 0) {
+    state.back() &= (std::uint64_t{1} << (width % 64)) - 1;
+  }
+  return n_splits;
+}
+
+inline int propagate_bitwise(const std::vector<std::vector<int>> &input) {
+  int n_splits = 0;
+  const size_t width = input[0].size();
+  std::vector<std::uint64_t> state = pack_row(input[0]);
+  for (size_t i = 1; i < input.size(); ++i) {
+    n_splits += perform_step_bitwise(state, pack_row(input[i]), width);
+  }
+  return n_splits;
+}
+
+inline void parse_row(const std::string_view line, const char symbol,
+                      std::vector<std::uint64_t> &mask) {
+  std::fill(mask.begin(), mask.end(), 0);
+  for (size_t i = 0; i < std::min(line.size(), mask.size() * 64); ++i) {
+    if (line[i] == symbol) {
+      mask[i / 64] |= std::uint64_t{1} << (i % 64);
+    }
+  }
+}
+
+// Propagates the beam while the file is read, without storing the manifold.
+// A second thread parses rows into a ring of n_buffered_rows splitter masks,
+// so memory is O(width) and parsing overlaps with propagation. The ring needs
+// at least one row, otherwise there is no slot to hand over between threads.
+inline int process_file_streaming(const std::string input_file_name,
+                                  const size_t n_buffered_rows = 4) {
+  if (n_buffered_rows == 0) {
+    throw std::invalid_argument("Expected at least one buffered row");
+  }
+  std::ifstream file(input_file_name);
+  std::string first_line;
+  if (!getline(file, first_line)) {
+    return 0;
+  }
+  const size_t width = first_line.size();
+  std::vector<std::uint64_t> state((width + 63) / 64, 0);
+  parse_row(first_line, 'S', state);
+
+  std::vector<std::vector<std::uint64_t>> buffer(
+      n_buffered_rows, std::vector<std::uint64_t>(state.size(), 0));
+  size_t n_parsed = 0;
+  size_t n_propagated = 0;
+  bool end_of_file = false;
+  std::mutex mutex;
+  std::condition_variable row_parsed, row_propagated;
+
+  std::thread parser([&]() {
+    std::string line;
+    while (getline(file, line)) {
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        row_propagated.wait(
+            lock, [&]() { return n_parsed - n_propagated < n_buffered_rows; });
+      }
+      parse_row(line, '^', buffer[n_parsed % n_buffered_rows]);
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++n_parsed;
+      }
+      row_parsed.notify_one();
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      end_of_file = true;
+    }
+    row_parsed.notify_one();
+  });
+
+  int n_splits = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      row_parsed.wait(
+          lock, [&]() { return n_propagated < n_parsed || end_of_file; });
+      if (n_propagated == n_parsed) {
+        break;
+      }
+    }
+    n_splits += perform_step_bitwise(
+        state, buffer[n_propagated % n_buffered_rows], width);
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      ++n_propagated;
+    }
+    row_propagated.notify_one();
+  }
+  parser.join();
+  return n_splits;
+}
+
+// Split counts for a beam entering at every column of the first row, computed
+// in one pass over the rows. Sources are bit-sliced: bit b of
+// lanes[column * n_batches + batch] is set if source 64 * batch + b has a beam
+// in that column. Only splitter columns change from one row to the next.
+inline std::vector<int>
+propagate_all_sources(const std::vector<std::vector<int>> &input) {
+  const size_t width = input[0].size();
+  const size_t n_batches = (width + 63) / 64;
+  std::vector<std::uint64_t> lanes(width * n_batches, 0);
+  for (size_t i = 0; i < width; ++i) {
+    lanes[i * n_batches + i / 64] = std::uint64_t{1} << (i % 64);
+  }
+  std::vector<int> result(width, 0);
+  std::vector<size_t> splitters;
+  std::vector<std::uint64_t> hits;
+  std::uint64_t hit;
+  for (size_t n_row = 1; n_row < input.size(); ++n_row) {
+    splitters.clear();
+    for (size_t i = 0; i < std::min(width, input[n_row].size()); ++i) {
+      if (input[n_row][i] == 1) {
+        splitters.push_back(i);
+      }
+    }
+    hits.resize(splitters.size() * n_batches);
+    for (size_t n = 0; n < splitters.size(); ++n) {
+      for (size_t b = 0; b < n_batches; ++b) {
+        hit = lanes[splitters[n] * n_batches + b];
+        hits[n * n_batches + b] = hit;
+        lanes[splitters[n] * n_batches + b] = 0;
+        while (hit != 0) {
+          ++result[64 * b + std::countr_zero(hit)];
+          hit &= hit - 1;
+        }
+      }
+    }
+    for (size_t n = 0; n < splitters.size(); ++n) {
+      for (size_t b = 0; b < n_batches; ++b) {
+        if (splitters[n] > 0) {
+          lanes[(splitters[n] - 1) * n_batches + b] |= hits[n * n_batches + b];
+        }
+        if (splitters[n] < width - 1) {
+          lanes[(splitters[n] + 1) * n_batches + b] |= hits[n * n_batches + b];
+        }
+      }
+    }
+  }
+  return result;
+}
+
+// Number of timelines, which may exceed 64 bits. The first limb is stored
+// separately so that counts that fit into 64 bits do not allocate.
+struct TimelineCount {
+  std::uint64_t low;
+  std::vector<std::uint64_t> high;
+
+  TimelineCount(const std::uint64_t low = 0) : low(low) {}
+
+  // other may be *this, so the carry is computed from the old value of low.
+  TimelineCount &operator+=(const TimelineCount &other) {
+    const std::uint64_t old_low = low;
+    low += other.low;
+    std::uint64_t carry = low < old_low ? 1 : 0;
+    if (other.high.size() > high.size()) {
+      high.resize(other.high.size(), 0);
+    }
+    std::uint64_t sum;
+    for (size_t i = 0; i < high.size(); ++i) {
+      sum = high[i] + (i < other.high.size() ? other.high[i] : 0);
+      std::uint64_t overflow = sum < high[i] ? 1 : 0;
+      sum += carry;
+      overflow |= sum < carry ? 1 : 0;
+      high[i] = sum;
+      carry = overflow;
+    }
+    if (carry) {
+      high.push_back(carry);
+    }
+    return *this;
+  }
+
+  bool operator==(const TimelineCount &other) const {
+    return low == other.low && high == other.high;
+  }
+
+  std::string to_string() const {
+    std::vector<std::uint32_t> digits;
+    digits.push_back(low & 0xffffffff);
+    digits.push_back(low >> 32);
+    for (auto limb : high) {
+      digits.push_back(limb & 0xffffffff);
+      digits.push_back(limb >> 32);
+    }
+    while (digits.size() > 1 && digits.back() == 0) {
+      digits.pop_back();
+    }
+    std::string result;
+    std::uint64_t remainder;
+    std::string block;
+    while (digits.size() > 1 || digits[0] >= 1000000000) {
+      remainder = 0;
+      for (size_t i = digits.size(); i-- > 0;) {
+        remainder = (remainder << 32) | digits[i];
+        digits[i] = remainder / 1000000000;
+        remainder %= 1000000000;
+      }
+      while (digits.size() > 1 && digits.back() == 0) {
+        digits.pop_back();
+      }
+      block = std::to_string(remainder);
+      result = std::string(9 - block.size(), '0') + block + result;
+    }
+    return std::to_string(digits[0]) + result;
+  }
+};
+
+// Timeline counts of the columns that are reached by at least one timeline,
+// sorted by column.
+using SparseCountRow = std::vector<std::pair<size_t, TimelineCount>>;
+
+inline void merge_columns(SparseCountRow &row) {
+  if (!std::is_sorted(row.begin(), row.end(),
+                      [](const auto &a, const auto &b) {
+                        return a.first < b.first;
+                      })) {
+    std::stable_sort(row.begin(), row.end(), [](const auto &a, const auto &b) {
+      return a.first < b.first;
+    });
+  }
+  size_t n_merged = 0;
+  for (size_t i = 0; i < row.size(); ++i) {
+    if (n_merged > 0 && row[n_merged - 1].first == row[i].first) {
+      row[n_merged - 1].second += row[i].second;
+    } else {
+      if (n_merged != i) {
+        row[n_merged] = std::move(row[i]);
+      }
+      ++n_merged;
+    }
+  }
+  row.resize(n_merged);
+}
+
+inline TimelineCount
+count_timelines(const std::vector<std::vector<int>> &input) {
+  const size_t width = input[0].size();
+  SparseCountRow counts, next_counts;
+  for (size_t i = 0; i < width; ++i) {
+    if (input[0][i] == 1) {
+      counts.push_back({i, TimelineCount(1)});
+    }
+  }
+  for (size_t n_row = 1; n_row < input.size(); ++n_row) {
+    next_counts.clear();
+    for (auto &column : counts) {
+      if (column.first < input[n_row].size() &&
+          input[n_row][column.first] == 1) {
+        if (column.first > 0) {
+          next_counts.push_back({column.first - 1, column.second});
+        }
+        if (column.first < width - 1) {
+          next_counts.push_back({column.first + 1, std::move(column.second)});
+        }
+      } else {
+        next_counts.push_back(std::move(column));
+      }
+    }
+    merge_columns(next_counts);
+    std::swap(counts, next_counts);
+  }
+  TimelineCount result;
+  for (const auto &column : counts) {
+    result += column.second;
+  }
+  return result;
+}
+
+inline int process_file(const std::string input_file_name){
+  std::vector<std::vector<int>> input = read_file(input_file_name);
+  return propagate(input);
+}
+
+// Answers to both parts of the puzzle for the given input.
+inline std::array<std::string, 2> solve(const std::string input_file_name) {
+  const std::vector<std::vector<int>> input = read_file(input_file_name);
+  return {std::to_string(propagate(input)), count_timelines(input).to_string()};
+}
+
+} // namespace day07
@@ -0,0 +1,150 @@
+#undef NDEBUG
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+
+#include "solver.hpp"
+
+using namespace day07;
+
+int main() {
+  std::cout << "Running unit tests ..." << std::endl;
+
+  std::vector<int> state{0, 0, 1, 0, 0};
+  perform_step(state, {0, 0, 0, 0, 0});
+  std::vector<int> state_after_step_1{0, 0, 1, 0, 0};
+  assert(state == state_after_step_1);
+  std::vector<int> state_after_step_2{0, 1, 0, 1, 0};
+  perform_step(state, {0, 0, 1, 0, 0});
+  assert(state == state_after_step_2);
+  perform_step(state, {1, 0, 0, 0, 0});
+  assert(state == state_after_step_2);
+  perform_step(state, {1, 0, 1, 0, 0});
+  assert(state == state_after_step_2);
+  std::vector<int> state_after_step_3{1, 0, 1, 1, 0};
+  perform_step(state, {0, 1, 0, 0, 0});
+  assert(state == state_after_step_3);
+
+  std::vector<std::uint64_t> packed_state = pack_row({0, 0, 1, 0, 0});
+  assert(packed_state.size() == 1);
+  assert(packed_state[0] == 0b00100);
+  assert(perform_step_bitwise(packed_state, pack_row({0, 0, 0, 0, 0}), 5) ==
+         0);
+  assert(unpack_row(packed_state, 5) == state_after_step_1);
+  assert(perform_step_bitwise(packed_state, pack_row({0, 0, 1, 0, 0}), 5) ==
+         1);
+  assert(unpack_row(packed_state, 5) == state_after_step_2);
+  perform_step_bitwise(packed_state, pack_row({1, 0, 0, 0, 0}), 5);
+  assert(unpack_row(packed_state, 5) == state_after_step_2);
+  perform_step_bitwise(packed_state, pack_row({1, 0, 1, 0, 0}), 5);
+  assert(unpack_row(packed_state, 5) == state_after_step_2);
+  assert(perform_step_bitwise(packed_state, pack_row({0, 1, 0, 0, 0}), 5) ==
+         1);
+  assert(unpack_row(packed_state, 5) == state_after_step_3);
+  assert(perform_step_bitwise(packed_state, pack_row({1, 0, 0, 0, 0}), 5) ==
+         1);
+  assert(unpack_row(packed_state, 5) == std::vector<int>({0, 1, 1, 1, 0}));
+
+  std::vector<int> wide_state(130, 0);
+  std::vector<int> wide_transform(130, 0);
+  wide_state[63] = 1;
+  wide_state[64] = 1;
+  wide_state[129] = 1;
+  wide_transform[63] = 1;
+  wide_transform[129] = 1;
+  packed_state = pack_row(wide_state);
+  assert(packed_state.size() == 3);
+  assert(perform_step_bitwise(packed_state, pack_row(wide_transform), 130) ==
+         2);
+  std::vector<int> wide_state_after_step(130, 0);
+  wide_state_after_step[62] = 1;
+  wide_state_after_step[64] = 1;
+  wide_state_after_step[128] = 1;
+  assert(unpack_row(packed_state, 130) == wide_state_after_step);
+
+  std::vector<std::uint64_t> mask(2, 0);
+  parse_row("^..^", '^', mask);
+  assert(mask[0] == 0b1001);
+  assert(mask[1] == 0);
+  parse_row(std::string(64, '.') + "S", 'S', mask);
+  assert(mask[0] == 0);
+  assert(mask[1] == 1);
+
+  TimelineCount timeline_count(std::uint64_t{0xffffffffffffffff});
+  assert(timeline_count.to_string() == "18446744073709551615");
+  timeline_count += TimelineCount(1);
+  assert(timeline_count.low == 0);
+  assert(timeline_count.high == std::vector<std::uint64_t>{1});
+  assert(timeline_count.to_string() == "18446744073709551616");
+  timeline_count += timeline_count;
+  assert(timeline_count.to_string() == "36893488147419103232");
+  TimelineCount doubled_count(std::uint64_t{1} << 63);
+  doubled_count += doubled_count;
+  assert(doubled_count.low == 0);
+  assert(doubled_count.high == std::vector<std::uint64_t>{1});
+  doubled_count.low = 0xc000000000000000;
+  doubled_count += doubled_count;
+  assert(doubled_count.low == 0x8000000000000000);
+  assert(doubled_count.high == std::vector<std::uint64_t>{3});
+  assert(TimelineCount(0).to_string() == "0");
+  assert(TimelineCount(1000000000).to_string() == "1000000000");
+
+  SparseCountRow sparse_row{{3, TimelineCount(1)},
+                            {1, TimelineCount(2)},
+                            {3, TimelineCount(4)}};
+  merge_columns(sparse_row);
+  assert(sparse_row.size() == 2);
+  assert(sparse_row[0].first == 1);
+  assert(sparse_row[0].second == TimelineCount(2));
+  assert(sparse_row[1].first == 3);
+  assert(sparse_row[1].second == TimelineCount(5));
+
+  std::vector<std::vector<int>> deep_manifold{{0, 0, 1, 0, 0}};
+  for (int i = 0; i < 100; ++i) {
+    deep_manifold.push_back({0, 0, 1, 0, 0});
+    deep_manifold.push_back({0, 1, 0, 1, 0});
+  }
+  assert(count_timelines(deep_manifold).to_string() ==
+         "3802951800684688204490109616126");
+
+  std::cout << "\tUnits tests completed successfully." << std::endl;
+
+  std::cout << "Running AOC test ..." << std::endl;
+
+  std::vector<std::vector<int>> input = read_file("input_test.txt");
+  std::vector<int> input_first_line{0, 0, 0, 0, 0, 0, 0, 1,
+                                    0, 0, 0, 0, 0, 0, 0};
+    std::vector<int> input_seventh_line{0, 0, 0, 0, 0, 1, 0, 1,
+                                    0, 1, 0, 0, 0, 0, 0};
+  assert(input[0] == input_first_line);
+  assert(input[6] == input_seventh_line);
+
+  assert(process_file("input_test.txt") == 21);
+  assert(propagate_bitwise(input) == 21);
+  assert(count_timelines(input) == TimelineCount(40));
+  std::vector<int> all_sources_result = propagate_all_sources(input);
+  assert(all_sources_result.size() == input[0].size());
+  assert(all_sources_result[7] == 21);
+  std::vector<std::vector<int>> single_source_input = input;
+  for (size_t i = 0; i < input[0].size(); ++i) {
+    single_source_input[0] = std::vector<int>(input[0].size(), 0);
+    single_source_input[0][i] = 1;
+    assert(all_sources_result[i] == propagate_bitwise(single_source_input));
+  }
+
+  for (size_t n_buffered_rows : {1, 2, 4, 64}) {
+    assert(process_file_streaming("input_test.txt", n_buffered_rows) == 21);
+  }
+
+  bool no_buffered_rows = false;
+  try {
+    process_file_streaming("input_test.txt", 0);
+  } catch (const std::invalid_argument &) {
+    no_buffered_rows = true;
+  }
+  assert(no_buffered_rows);
+
+  std::cout << "\tAOC test completed successfully." << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,48 @@
+#include "common/bench.hpp"
+#include "solver.hpp"
+
+using namespace day08;
+
+// bench08 --benchmark-sort [N_EDGES ...] times radix_sort against std::sort
+// instead of running the registered benchmarks. Without sizes, it runs up to
+// 10^8 edges. 10^9 edges need about 32 GB, so that size has to be asked for.
+int main(int argc, char *argv[]) {
+  if (argc > 1 && std::string(argv[1]) == "--benchmark-sort") {
+    std::vector<size_t> n_edges_list{1000000, 10000000, 100000000};
+    if (argc > 2) {
+      n_edges_list.clear();
+      for (int i = 2; i < argc; ++i) {
+        n_edges_list.push_back(std::stoull(argv[i]));
+      }
+    }
+    std::cout << "Running sort benchmark ..." << std::endl;
+    benchmark_sort(n_edges_list);
+    return 0;
+  }
+
+  aoc::Benchmark benchmark("08", argc, argv);
+  const std::string input_file_name = benchmark.input_file_name;
+  const std::vector<JunctionBox> jbs = read_file(input_file_name);
+
+  benchmark.add("read_file", [&]() {
+    aoc::do_not_optimize(read_file(input_file_name));
+  });
+  benchmark.add("evaluate_distances",
+                [&]() { aoc::do_not_optimize(evaluate_distances(jbs)); });
+  benchmark.add("shortest_distances",
+                [&]() { aoc::do_not_optimize(shortest_distances(jbs, 1000)); });
+  benchmark.add("evaluate_kruskal", [&]() {
+    aoc::do_not_optimize(evaluate_kruskal(jbs, 1000, 3));
+  });
+  benchmark.add("evaluate_packed", [&]() {
+    aoc::do_not_optimize(evaluate_packed(jbs, 1000, 3));
+  });
+  benchmark.add("find_last_connection_emst", [&]() {
+    aoc::do_not_optimize(find_last_connection_emst(jbs));
+  });
+  benchmark.add("process_file", [&]() {
+    aoc::do_not_optimize(process_file(input_file_name, 1000, 3));
+  });
+
+  return benchmark.run();
+}
@@ -0,0 +1,888 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory_resource>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "common/input.hpp"
+#include "common/instrument.hpp"
+#include "common/memory.hpp"
+
+namespace day08 {
+
+struct Distance {
+  double value;
+  int jb1;
+  int jb2;
+
+  Distance(const double value, const int jb1, const int jb2)
+      : value(value), jb1(jb1), jb2(jb2){};
+
+  // Ties in distance are broken by the boxes, as in all other engines.
+  bool operator<(const Distance &d) const {
+    return std::tie(value, jb1, jb2) < std::tie(d.value, d.jb1, d.jb2);
+  }
+};
+
+// Coordinates are limited so that the differences along all three axes can be
+// squared and summed in a long long by every engine.
+constexpr int max_coordinate = 1 << 29;
+
+struct JunctionBox {
+  std::array<int, 3> position;
+  int circuit;
+
+  JunctionBox(const std::array<int, 3> position, int circuit = -1)
+      : position(position), circuit(circuit) {
+    for (int coordinate : position) {
+      if (coordinate < -max_coordinate || coordinate > max_coordinate) {
+        throw std::out_of_range("Junction box coordinate " +
+                                std::to_string(coordinate) +
+                                " is out of range.");
+      }
+    }
+  }
+};
+
+inline void reset_circuits(std::vector<JunctionBox> &jbs) {
+  for (size_t i = 0; i < jbs.size(); ++i) {
+    jbs[i].circuit = -(i + 1);
+  }
+}
+
+inline double distance(const JunctionBox jb1, const JunctionBox jb2) {
+  return (pow((double)jb1.position[0] - jb2.position[0], 2) +
+          pow((double)jb1.position[1] - jb2.position[1], 2) +
+          pow((double)jb1.position[2] - jb2.position[2], 2));
+}
+
+inline std::pmr::vector<Distance> evaluate_distances(
+    const std::vector<JunctionBox> &junction_boxes,
+    std::pmr::memory_resource *resource = std::pmr::get_default_resource()) {
+  AOC_PHASE("08/evaluate_distances");
+  std::pmr::vector<Distance> result(resource);
+  result.reserve(junction_boxes.size() * (junction_boxes.size() - 1) / 2);
+  for (size_t i = 0; i < junction_boxes.size(); ++i) {
+    for (size_t j = i + 1; j < junction_boxes.size(); ++j) {
+      result.push_back(
+          Distance(distance(junction_boxes[i], junction_boxes[j]), i, j));
+    }
+  }
+  return result;
+}
+
+// Only copies the distances if they have to be sorted first.
+inline void evaluate_circuits(const std::pmr::vector<Distance> &dis,
+                              std::vector<JunctionBox> &jbs, size_t n_max,
+                              bool sort_distances = true) {
+  if (sort_distances) {
+    std::pmr::vector<Distance> sorted(dis, dis.get_allocator());
+    std::sort(sorted.begin(), sorted.end());
+    evaluate_circuits(sorted, jbs, n_max, false);
+    return;
+  }
+  AOC_PHASE("08/evaluate_circuits");
+  int current_circuit = 0;
+  int united_circuit, old_circuit;
+  n_max = std::min(n_max, dis.size());
+  for (size_t n = 0; n < n_max; ++n) {
+    if (jbs[dis[n].jb1].circuit < 0 && jbs[dis[n].jb2].circuit < 0) {
+      jbs[dis[n].jb1].circuit = current_circuit;
+      jbs[dis[n].jb2].circuit = current_circuit;
+      ++current_circuit;
+    } else if (jbs[dis[n].jb1].circuit != jbs[dis[n].jb2].circuit) {
+      if (jbs[dis[n].jb1].circuit < 0 && jbs[dis[n].jb2].circuit >= 0) {
+        jbs[dis[n].jb1].circuit = jbs[dis[n].jb2].circuit;
+      } else if (jbs[dis[n].jb2].circuit < 0 && jbs[dis[n].jb1].circuit >= 0) {
+        jbs[dis[n].jb2].circuit = jbs[dis[n].jb1].circuit;
+      } else {
+        AOC_COUNT("08/merges");
+        united_circuit =
+            std::min({jbs[dis[n].jb1].circuit, jbs[dis[n].jb2].circuit});
+        old_circuit =
+            std::max({jbs[dis[n].jb1].circuit, jbs[dis[n].jb2].circuit});
+        for (size_t m = 0; m < jbs.size(); ++m) {
+          if (jbs[m].circuit == old_circuit) {
+            jbs[m].circuit = united_circuit;
+          }
+        }
+      }
+    }
+  }
+}
+
+inline std::vector<std::pair<int, int>>
+count_circuits(const std::vector<JunctionBox> &jbs) {
+  AOC_PHASE("08/count_circuits");
+  std::vector<std::pair<int, int>> result;
+  bool circuit_found = false;
+  for (auto jb : jbs) {
+    circuit_found = false;
+    for (size_t i = 0; i < result.size(); ++i) {
+      if (result[i].second == jb.circuit) {
+        result[i].first += 1;
+        circuit_found = true;
+        break;
+      }
+    }
+    if (!circuit_found) {
+      result.push_back(std::pair<int, int>{1, jb.circuit});
+    }
+  }
+  return result;
+}
+
+inline int score(std::vector<std::pair<int, int>> circuits, int n_max) {
+  int result = 1;
+  int n = 0;
+  std::sort(circuits.begin(), circuits.end());
+  for (int i = circuits.size() - 1; i >= 0; --i) {
+    if (circuits[i].second >= 0) {
+      result *= circuits[i].first;
+      ++n;
+    }
+    if (n == n_max) {
+      break;
+    }
+  }
+  return result;
+}
+
+// Connects more and more of the shortest pairs, each time from unconnected
+// boxes, until at most two circuits are left. The shortest pair between them
+// is the connection that joins the last two circuits.
+inline long long
+find_last_pairs_product_of_x_coordinates(std::pmr::vector<Distance> dis,
+                                         std::vector<JunctionBox> &jbs) {
+  std::sort(dis.begin(), dis.end());
+  reset_circuits(jbs);
+  std::vector<std::pair<int, int>> circuit_stats = count_circuits(jbs);
+  size_t n = 0;
+  while (circuit_stats.size() > 2 && n < dis.size()) {
+    reset_circuits(jbs);
+    evaluate_circuits(dis, jbs, ++n, false);
+    circuit_stats = count_circuits(jbs);
+  }
+  for (auto d : dis) {
+    if (jbs[d.jb1].circuit != jbs[d.jb2].circuit) {
+      return (long long)jbs[d.jb1].position[0] * jbs[d.jb2].position[0];
+    }
+  }
+  return 0ll;
+}
+
+inline std::pair<int, long long> evaluate(std::vector<JunctionBox> jbs,
+                                          const int n_max_pairs, int n_max) {
+  aoc::Arena arena("08/distances");
+  std::pmr::vector<Distance> dis = evaluate_distances(jbs, arena.resource());
+  std::sort(dis.begin(), dis.end());
+  evaluate_circuits(dis, jbs, n_max_pairs, false);
+  std::vector<std::pair<int, int>> circuit_stats = count_circuits(jbs);
+  reset_circuits(jbs);
+  return {score(circuit_stats, n_max),
+          find_last_pairs_product_of_x_coordinates(std::move(dis), jbs)};
+}
+
+// Exact as long as every coordinate difference is below about 1.7e9, so that
+// the sum of the three squares fits into a long long.
+inline long long squared_distance(const std::array<int, 3> &p1,
+                                  const std::array<int, 3> &p2) {
+  long long result = 0;
+  long long difference;
+  for (int i = 0; i < 3; ++i) {
+    difference = (long long)p1[i] - p2[i];
+    result += difference * difference;
+  }
+  return result;
+}
+
+// Balanced k-d tree over the junction box positions. The tree is implicit:
+// a node covers the slots [lo, hi) and splits them at mid = (lo + hi) / 2
+// along axis[mid]. Nodes with at most leaf_size slots are not split.
+struct KdTree {
+  static constexpr int leaf_size = 8;
+  std::vector<int> index;
+  std::vector<std::array<int, 3>> points;
+  std::vector<int> axis;
+
+  KdTree(const std::vector<JunctionBox> &jbs)
+      : index(jbs.size()), points(jbs.size()), axis(jbs.size(), 0) {
+    std::iota(index.begin(), index.end(), 0);
+    build(jbs, 0, jbs.size());
+    for (size_t i = 0; i < index.size(); ++i) {
+      points[i] = jbs[index[i]].position;
+    }
+  }
+
+  void build(const std::vector<JunctionBox> &jbs, const int lo, const int hi) {
+    if (hi - lo <= leaf_size) {
+      return;
+    }
+    std::array<int, 3> low = jbs[index[lo]].position;
+    std::array<int, 3> high = low;
+    for (int i = lo + 1; i < hi; ++i) {
+      for (int n_axis = 0; n_axis < 3; ++n_axis) {
+        low[n_axis] = std::min(low[n_axis], jbs[index[i]].position[n_axis]);
+        high[n_axis] = std::max(high[n_axis], jbs[index[i]].position[n_axis]);
+      }
+    }
+    int split_axis = 0;
+    for (int n_axis = 1; n_axis < 3; ++n_axis) {
+      if (high[n_axis] - low[n_axis] > high[split_axis] - low[split_axis]) {
+        split_axis = n_axis;
+      }
+    }
+    const int mid = (lo + hi) / 2;
+    axis[mid] = split_axis;
+    std::nth_element(index.begin() + lo, index.begin() + mid,
+                     index.begin() + hi, [&](const int a, const int b) {
+                       return jbs[a].position[split_axis] <
+                              jbs[b].position[split_axis];
+                     });
+    build(jbs, lo, mid);
+    build(jbs, mid + 1, hi);
+  }
+
+  // Calls visit(slot, squared_distance) for every slot that is not farther
+  // than radius_sq from position, so that ties at the radius are seen as well.
+  // visit may shrink radius_sq during the search.
+  template <typename Visitor>
+  void search(const std::array<int, 3> &position, const long long &radius_sq,
+              Visitor &&visit) const {
+    search(position, radius_sq, visit, 0, index.size());
+  }
+
+  template <typename Visitor>
+  void search(const std::array<int, 3> &position, const long long &radius_sq,
+              Visitor &visit, const int lo, const int hi) const {
+    long long d;
+    if (hi - lo <= leaf_size) {
+      for (int i = lo; i < hi; ++i) {
+        d = squared_distance(position, points[i]);
+        if (d <= radius_sq) {
+          visit(i, d);
+        }
+      }
+      return;
+    }
+    const int mid = (lo + hi) / 2;
+    const long long offset =
+        (long long)position[axis[mid]] - points[mid][axis[mid]];
+    d = squared_distance(position, points[mid]);
+    if (d <= radius_sq) {
+      visit(mid, d);
+    }
+    if (offset < 0) {
+      search(position, radius_sq, visit, lo, mid);
+      if (offset * offset <= radius_sq) {
+        search(position, radius_sq, visit, mid + 1, hi);
+      }
+    } else {
+      search(position, radius_sq, visit, mid + 1, hi);
+      if (offset * offset <= radius_sq) {
+        search(position, radius_sq, visit, lo, mid);
+      }
+    }
+  }
+};
+
+// The n_pairs shortest distances in ascending order, found with a k-d tree
+// and a bounded max-heap instead of evaluating all pairs. The heap is ordered
+// by (distance, jb1, jb2), so ties are resolved like in the other engines. The
+// search radius of each box is the largest distance in the heap once it is
+// full.
+inline std::vector<Distance>
+shortest_distances(const std::vector<JunctionBox> &jbs, const size_t n_pairs) {
+  std::vector<Distance> result;
+  if (n_pairs == 0) {
+    return result;
+  }
+  KdTree tree(jbs);
+  std::priority_queue<std::tuple<long long, int, int>> heap;
+  long long radius_sq;
+  int jb;
+  for (size_t slot = 0; slot < tree.index.size(); ++slot) {
+    jb = tree.index[slot];
+    radius_sq = heap.size() < n_pairs ? std::numeric_limits<long long>::max()
+                                      : std::get<0>(heap.top());
+    tree.search(tree.points[slot], radius_sq,
+                [&](const int i, const long long d) {
+                  if (tree.index[i] <= jb) {
+                    return;
+                  }
+                  heap.push({d, jb, tree.index[i]});
+                  if (heap.size() > n_pairs) {
+                    heap.pop();
+                  }
+                  if (heap.size() == n_pairs) {
+                    radius_sq = std::get<0>(heap.top());
+                  }
+                });
+  }
+  while (!heap.empty()) {
+    result.push_back(Distance(std::get<0>(heap.top()), std::get<1>(heap.top()),
+                              std::get<2>(heap.top())));
+    heap.pop();
+  }
+  std::reverse(result.begin(), result.end());
+  return result;
+}
+
+// Disjoint sets of junction boxes with path compression and union by size.
+// size_histogram maps the size of each circuit with at least two boxes to the
+// number of such circuits, so the largest circuits can be read directly.
+struct CircuitTracker {
+  std::vector<int> parent;
+  std::vector<int> size;
+  std::map<int, int> size_histogram;
+  int n_circuits;
+
+  CircuitTracker(const size_t n_jbs)
+      : parent(n_jbs), size(n_jbs, 1), n_circuits(n_jbs) {
+    std::iota(parent.begin(), parent.end(), 0);
+  }
+
+  int find(int jb) {
+    int root = jb;
+    while (parent[root] != root) {
+      root = parent[root];
+    }
+    while (parent[jb] != root) {
+      int next = parent[jb];
+      parent[jb] = root;
+      jb = next;
+    }
+    return root;
+  }
+
+  void remove_from_histogram(const int circuit_size) {
+    if (circuit_size > 1 && --size_histogram[circuit_size] == 0) {
+      size_histogram.erase(circuit_size);
+    }
+  }
+
+  // Returns false if both boxes are already in the same circuit.
+  bool unite(const int jb1, const int jb2) {
+    int root_1 = find(jb1);
+    int root_2 = find(jb2);
+    if (root_1 == root_2) {
+      return false;
+    }
+    if (size[root_1] < size[root_2]) {
+      std::swap(root_1, root_2);
+    }
+    remove_from_histogram(size[root_1]);
+    remove_from_histogram(size[root_2]);
+    parent[root_2] = root_1;
+    size[root_1] += size[root_2];
+    ++size_histogram[size[root_1]];
+    --n_circuits;
+    return true;
+  }
+
+  int score(const int n_max) const {
+    int result = 1;
+    int n = 0;
+    for (auto it = size_histogram.rbegin();
+         it != size_histogram.rend() && n < n_max; ++it) {
+      for (int i = 0; i < it->second && n < n_max; ++i) {
+        result *= it->first;
+        ++n;
+      }
+    }
+    return result;
+  }
+};
+
+inline int evaluate_nearest_circuits(const std::vector<JunctionBox> &jbs,
+                                     const int n_max_pairs, int n_max) {
+  CircuitTracker tracker(jbs.size());
+  for (auto d : shortest_distances(jbs, n_max_pairs)) {
+    tracker.unite(d.jb1, d.jb2);
+  }
+  return tracker.score(n_max);
+}
+
+// Connects n_pairs pairs in ascending order of distance in a single pass, where
+// pair(n) returns the boxes of the n-th shortest pair. The score is recorded
+// after n_max_pairs connections, and the product of the x coordinates at the
+// connection that joins the last two circuits.
+template <typename Pair>
+std::pair<int, long long>
+connect_circuits(const std::vector<JunctionBox> &jbs, const size_t n_pairs,
+                 Pair &&pair, const size_t n_max_pairs, const int n_max) {
+  CircuitTracker tracker(jbs.size());
+  std::pair<int, long long> result{0, 0ll};
+  std::pair<int, int> boxes;
+  for (size_t n = 0; n < n_pairs; ++n) {
+    if (n == n_max_pairs) {
+      result.first = tracker.score(n_max);
+    }
+    if (n >= n_max_pairs && tracker.n_circuits == 1) {
+      break;
+    }
+    boxes = pair(n);
+    if (tracker.unite(boxes.first, boxes.second) && tracker.n_circuits == 1) {
+      result.second = (long long)jbs[boxes.first].position[0] *
+                      jbs[boxes.second].position[0];
+    }
+  }
+  if (n_max_pairs >= n_pairs) {
+    result.first = tracker.score(n_max);
+  }
+  return result;
+}
+
+inline std::pair<int, long long>
+connect_circuits(const std::vector<JunctionBox> &jbs,
+                 const std::pmr::vector<Distance> &sorted_dis,
+                 const size_t n_max_pairs, const int n_max) {
+  return connect_circuits(
+      jbs, sorted_dis.size(),
+      [&](const size_t n) {
+        return std::pair<int, int>{sorted_dis[n].jb1, sorted_dis[n].jb2};
+      },
+      n_max_pairs, n_max);
+}
+
+inline std::pair<int, long long>
+evaluate_kruskal(const std::vector<JunctionBox> &jbs, const size_t n_max_pairs,
+                 const int n_max) {
+  aoc::Arena arena("08/distances");
+  std::pmr::vector<Distance> dis = evaluate_distances(jbs, arena.resource());
+  std::sort(dis.begin(), dis.end());
+  return connect_circuits(jbs, dis, n_max_pairs, n_max);
+}
+
+inline unsigned default_n_threads() {
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Positions in structure-of-arrays layout for the distance kernel.
+struct Positions {
+  std::vector<std::int32_t> x;
+  std::vector<std::int32_t> y;
+  std::vector<std::int32_t> z;
+
+  Positions(const std::vector<JunctionBox> &jbs) {
+    for (auto jb : jbs) {
+      x.push_back(jb.position[0]);
+      y.push_back(jb.position[1]);
+      z.push_back(jb.position[2]);
+    }
+  }
+};
+
+// Packs a pair into a 64-bit key: the exact squared distance in the high bits
+// and i * n_jbs + j in the low bits. Sorting the keys sorts the pairs by
+// distance, and ties by (jb1, jb2).
+struct EdgeKeyLayout {
+  std::uint64_t n_jbs;
+  int index_bits;
+  int key_bits;
+
+  EdgeKeyLayout(const Positions &positions) : n_jbs(positions.x.size()) {
+    index_bits = std::bit_width(n_jbs * n_jbs);
+    std::uint64_t max_distance = 0, extent;
+    bool wrapped = false;
+    for (auto coordinates : {&positions.x, &positions.y, &positions.z}) {
+      if (coordinates->empty()) {
+        continue;
+      }
+      auto [low, high] =
+          std::minmax_element(coordinates->begin(), coordinates->end());
+      // Every square fits into 64 bits, but their sum may wrap around.
+      extent = (std::int64_t)*high - *low;
+      wrapped |= max_distance >
+                 std::numeric_limits<std::uint64_t>::max() - extent * extent;
+      max_distance += extent * extent;
+    }
+    key_bits = std::bit_width(max_distance) + index_bits;
+    if (wrapped || key_bits > 64) {
+      throw std::overflow_error(
+          "Squared distances and box indices do not fit into 64 bits.");
+    }
+  }
+
+  std::uint64_t pack(const std::uint64_t distance, const std::uint64_t jb1,
+                     const std::uint64_t jb2) const {
+    return (distance << index_bits) | (jb1 * n_jbs + jb2);
+  }
+
+  std::uint64_t distance(const std::uint64_t key) const {
+    return key >> index_bits;
+  }
+
+  int jb1(const std::uint64_t key) const {
+    return (key & ((std::uint64_t{1} << index_bits) - 1)) / n_jbs;
+  }
+
+  int jb2(const std::uint64_t key) const {
+    return (key & ((std::uint64_t{1} << index_bits) - 1)) % n_jbs;
+  }
+};
+
+// Packed keys of all pairs (i, j) with i < j, in the same order as
+// evaluate_distances. The inner loop over j has no branches, so it is
+// vectorized by the compiler, and rows i are distributed over threads.
+inline std::vector<std::uint64_t>
+evaluate_edge_keys(const Positions &positions, const EdgeKeyLayout &layout,
+                   const unsigned n_threads) {
+  const std::int64_t n_jbs = positions.x.size();
+  std::vector<std::uint64_t> result(n_jbs * (n_jbs - 1) / 2);
+  std::atomic<std::int64_t> next_row{0};
+  auto worker = [&, n_jbs]() {
+    const std::int32_t *x = positions.x.data();
+    const std::int32_t *y = positions.y.data();
+    const std::int32_t *z = positions.z.data();
+    const int index_bits = layout.index_bits;
+    for (std::int64_t i = next_row++; i < n_jbs - 1; i = next_row++) {
+      std::uint64_t *keys = result.data() + i * (n_jbs - 1) - i * (i - 1) / 2;
+      const std::int64_t xi = x[i];
+      const std::int64_t yi = y[i];
+      const std::int64_t zi = z[i];
+      const std::uint64_t row_index = i * n_jbs;
+      for (std::int64_t j = 0; j < n_jbs - i - 1; ++j) {
+        const std::int64_t dx = x[i + 1 + j] - xi;
+        const std::int64_t dy = y[i + 1 + j] - yi;
+        const std::int64_t dz = z[i + 1 + j] - zi;
+        keys[j] = ((std::uint64_t)(dx * dx + dy * dy + dz * dz) << index_bits) |
+                  (row_index + i + 1 + j);
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  for (unsigned i = 1; i < n_threads; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  return result;
+}
+
+template <typename Task>
+void run_on_threads(const unsigned n_threads, Task &&task) {
+  std::vector<std::thread> threads;
+  for (unsigned i = 1; i < n_threads; ++i) {
+    threads.emplace_back(task, i);
+  }
+  task(0);
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+
+// Stable LSD radix sort of keys that are smaller than 2^key_bits, one byte
+// per pass. Every thread counts the digits of its own chunk, so the chunks can
+// be scattered in parallel while equal digits keep their order. Passes in
+// which all keys have the same digit are skipped.
+inline void radix_sort(std::vector<std::uint64_t> &keys, const int key_bits,
+                       const unsigned n_threads = default_n_threads()) {
+  const size_t n_keys = keys.size();
+  const size_t chunk_size = (n_keys + n_threads - 1) / n_threads;
+  std::vector<std::uint64_t> buffer(n_keys);
+  std::vector<std::array<size_t, 256>> offsets(n_threads);
+  auto chunk_begin = [&](const unsigned n_thread) {
+    return std::min(n_keys, n_thread * chunk_size);
+  };
+  for (int shift = 0; shift < key_bits; shift += 8) {
+    run_on_threads(n_threads, [&](const unsigned n_thread) {
+      offsets[n_thread].fill(0);
+      for (size_t i = chunk_begin(n_thread); i < chunk_begin(n_thread + 1);
+           ++i) {
+        ++offsets[n_thread][(keys[i] >> shift) & 0xff];
+      }
+    });
+    size_t offset = 0;
+    size_t digit_count;
+    bool single_digit = false;
+    for (int digit = 0; digit < 256; ++digit) {
+      digit_count = 0;
+      for (unsigned n_thread = 0; n_thread < n_threads; ++n_thread) {
+        digit_count += offsets[n_thread][digit];
+        std::swap(offsets[n_thread][digit], offset);
+        offset += offsets[n_thread][digit];
+      }
+      single_digit |= digit_count == n_keys;
+    }
+    if (single_digit) {
+      continue;
+    }
+    run_on_threads(n_threads, [&](const unsigned n_thread) {
+      std::array<size_t, 256> &position = offsets[n_thread];
+      for (size_t i = chunk_begin(n_thread); i < chunk_begin(n_thread + 1);
+           ++i) {
+        buffer[position[(keys[i] >> shift) & 0xff]++] = keys[i];
+      }
+    });
+    std::swap(keys, buffer);
+  }
+}
+
+// Compares the current sort of Distance objects with the radix sort of packed
+// keys for n_edges random pairs of n_jbs = sqrt(2 * n_edges) boxes.
+inline void benchmark_sort(const std::vector<size_t> &n_edges_list) {
+  std::mt19937_64 generator(2025);
+  for (auto n_edges : n_edges_list) {
+    const std::uint64_t n_jbs = std::sqrt(2.0 * n_edges) + 1;
+    const int index_bits = std::bit_width(n_jbs * n_jbs);
+    const int key_bits = std::min(64, index_bits + 35);
+    std::vector<Distance> dis;
+    std::vector<std::uint64_t> keys;
+    dis.reserve(n_edges);
+    keys.reserve(n_edges);
+    std::uint64_t distance;
+    for (size_t n = 0; n < n_edges; ++n) {
+      distance = generator() >> (64 - (key_bits - index_bits));
+      dis.push_back(Distance(distance, n / n_jbs, n % n_jbs));
+      keys.push_back((distance << index_bits) | n);
+    }
+    auto start = std::chrono::steady_clock::now();
+    std::sort(dis.begin(), dis.end());
+    auto stop = std::chrono::steady_clock::now();
+    const double std_sort_time =
+        std::chrono::duration<double>(stop - start).count();
+    start = std::chrono::steady_clock::now();
+    radix_sort(keys, key_bits);
+    stop = std::chrono::steady_clock::now();
+    const double radix_sort_time =
+        std::chrono::duration<double>(stop - start).count();
+    std::cout << "\t" << n_edges << " edges: std::sort " << std_sort_time
+              << " s, radix_sort " << radix_sort_time << " s" << std::endl;
+  }
+}
+
+inline std::pair<int, long long>
+connect_circuits(const std::vector<JunctionBox> &jbs,
+                 const std::vector<std::uint64_t> &sorted_keys,
+                 const EdgeKeyLayout &layout, const size_t n_max_pairs,
+                 const int n_max) {
+  return connect_circuits(
+      jbs, sorted_keys.size(),
+      [&](const size_t n) {
+        return std::pair<int, int>{layout.jb1(sorted_keys[n]),
+                                   layout.jb2(sorted_keys[n])};
+      },
+      n_max_pairs, n_max);
+}
+
+inline std::pair<int, long long>
+evaluate_packed(const std::vector<JunctionBox> &jbs, const size_t n_max_pairs,
+                const int n_max,
+                const unsigned n_threads = default_n_threads()) {
+  Positions positions(jbs);
+  EdgeKeyLayout layout(positions);
+  std::vector<std::uint64_t> keys =
+      evaluate_edge_keys(positions, layout, n_threads);
+  radix_sort(keys, layout.key_bits, n_threads);
+  return connect_circuits(jbs, keys, layout, n_max_pairs, n_max);
+}
+
+// Pairs are ordered by distance and then by the indices of the boxes, so that
+// all threads agree on a single minimum spanning tree when distances tie.
+using Edge = std::tuple<long long, int, int>;
+
+// Marks every node of the k-d tree with the circuit of its boxes, or -1 if the
+// boxes belong to different circuits.
+inline int label_nodes(const KdTree &tree,
+                       const std::vector<int> &slot_circuits,
+                       std::vector<int> &node_circuits, const int lo,
+                       const int hi) {
+  const int mid = (lo + hi) / 2;
+  int circuit = slot_circuits[lo];
+  if (hi - lo <= KdTree::leaf_size) {
+    for (int i = lo + 1; i < hi; ++i) {
+      if (slot_circuits[i] != circuit) {
+        circuit = -1;
+      }
+    }
+  } else {
+    const int circuit_lo =
+        label_nodes(tree, slot_circuits, node_circuits, lo, mid);
+    const int circuit_hi =
+        label_nodes(tree, slot_circuits, node_circuits, mid + 1, hi);
+    circuit = circuit_lo == circuit_hi && circuit_lo == slot_circuits[mid]
+                  ? circuit_lo
+                  : -1;
+  }
+  node_circuits[mid] = circuit;
+  return circuit;
+}
+
+inline void nearest_in_other_circuit(const KdTree &tree,
+                                     const std::vector<int> &slot_circuits,
+                                     const std::vector<int> &node_circuits,
+                                     const int slot, const int lo, const int hi,
+                                     Edge &best) {
+  const int mid = (lo + hi) / 2;
+  if (node_circuits[mid] == slot_circuits[slot]) {
+    return;
+  }
+  const std::array<int, 3> &position = tree.points[slot];
+  auto consider = [&](const int other) {
+    if (slot_circuits[other] == slot_circuits[slot]) {
+      return;
+    }
+    const long long d = squared_distance(position, tree.points[other]);
+    if (d > std::get<0>(best)) {
+      return;
+    }
+    Edge candidate{d, std::min(tree.index[slot], tree.index[other]),
+                   std::max(tree.index[slot], tree.index[other])};
+    if (candidate < best) {
+      best = candidate;
+    }
+  };
+  if (hi - lo <= KdTree::leaf_size) {
+    for (int i = lo; i < hi; ++i) {
+      consider(i);
+    }
+    return;
+  }
+  consider(mid);
+  const long long offset =
+      (long long)position[tree.axis[mid]] - tree.points[mid][tree.axis[mid]];
+  const int near_lo = offset < 0 ? lo : mid + 1;
+  const int near_hi = offset < 0 ? mid : hi;
+  const int far_lo = offset < 0 ? mid + 1 : lo;
+  const int far_hi = offset < 0 ? hi : mid;
+  nearest_in_other_circuit(tree, slot_circuits, node_circuits, slot, near_lo,
+                           near_hi, best);
+  if (offset * offset <= std::get<0>(best)) {
+    nearest_in_other_circuit(tree, slot_circuits, node_circuits, slot, far_lo,
+                             far_hi, best);
+  }
+}
+
+// The last connection of part 2 is the longest edge of the Euclidean minimum
+// spanning tree. It is found with Boruvka's algorithm: in each round, every
+// box looks up its nearest box in another circuit with the k-d tree, in
+// parallel, and every circuit is joined along its shortest outgoing edge.
+inline long long find_last_connection_emst(const std::vector<JunctionBox> &jbs,
+                                           const unsigned n_threads =
+                                               default_n_threads()) {
+  const int n_jbs = jbs.size();
+  if (n_jbs < 2) {
+    return 0ll;
+  }
+  KdTree tree(jbs);
+  CircuitTracker tracker(n_jbs);
+  std::vector<int> slot_circuits(n_jbs);
+  std::vector<int> node_circuits(n_jbs);
+  std::vector<Edge> slot_best(n_jbs);
+  std::vector<Edge> circuit_best(n_jbs);
+  const Edge no_edge{std::numeric_limits<long long>::max(), -1, -1};
+  Edge longest_edge{-1, -1, -1};
+  const int chunk_size = 256;
+  while (tracker.n_circuits > 1) {
+    for (int slot = 0; slot < n_jbs; ++slot) {
+      slot_circuits[slot] = tracker.find(tree.index[slot]);
+    }
+    label_nodes(tree, slot_circuits, node_circuits, 0, n_jbs);
+
+    std::atomic<int> next_slot{0};
+    auto worker = [&]() {
+      for (int first = next_slot.fetch_add(chunk_size); first < n_jbs;
+           first = next_slot.fetch_add(chunk_size)) {
+        for (int slot = first; slot < std::min(first + chunk_size, n_jbs);
+             ++slot) {
+          slot_best[slot] = no_edge;
+          nearest_in_other_circuit(tree, slot_circuits, node_circuits, slot,
+                                   0, n_jbs, slot_best[slot]);
+        }
+      }
+    };
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < n_threads; ++i) {
+      threads.emplace_back(worker);
+    }
+    worker();
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    std::fill(circuit_best.begin(), circuit_best.end(), no_edge);
+    for (int slot = 0; slot < n_jbs; ++slot) {
+      circuit_best[slot_circuits[slot]] =
+          std::min(circuit_best[slot_circuits[slot]], slot_best[slot]);
+    }
+    for (int jb = 0; jb < n_jbs; ++jb) {
+      if (std::get<1>(circuit_best[jb]) >= 0 &&
+          tracker.unite(std::get<1>(circuit_best[jb]),
+                        std::get<2>(circuit_best[jb]))) {
+        longest_edge = std::max(longest_edge, circuit_best[jb]);
+      }
+    }
+  }
+  return (long long)jbs[std::get<1>(longest_edge)].position[0] *
+         jbs[std::get<2>(longest_edge)].position[0];
+}
+
+// Both parts without evaluating all pairs: the shortest pairs for part 1 and
+// the minimum spanning tree for part 2 both come from the k-d tree.
+inline std::pair<int, long long>
+evaluate_kd_tree(const std::vector<JunctionBox> &jbs, const int n_max_pairs,
+                 const int n_max,
+                 const unsigned n_threads = default_n_threads()) {
+  return {evaluate_nearest_circuits(jbs, n_max_pairs, n_max),
+          find_last_connection_emst(jbs, n_threads)};
+}
+
+inline std::vector<JunctionBox> read_file(const std::string input_file_name) {
+  AOC_PHASE("08/read_file");
+  std::vector<JunctionBox> result;
+  int x, y, z;
+  const std::string input = aoc::read_input(input_file_name);
+  aoc::LineReader lines(input);
+  std::string_view line;
+  size_t first_comma, second_comma;
+  int n_jb = 0;
+  while (lines.next(line)) {
+    first_comma = line.find(',');
+    x = aoc::parse_integer<int>(line.substr(0, first_comma));
+    second_comma = line.find(',', first_comma + 1);
+    y = aoc::parse_integer<int>(
+        line.substr(first_comma + 1, second_comma - first_comma - 1));
+    z = aoc::parse_integer<int>(line.substr(second_comma + 1));
+    result.push_back(JunctionBox({x, y, z}, -(n_jb + 1)));
+  }
+  return result;
+}
+
+inline std::pair<int, long long>
+process_file(const std::string input_file_name, const int n_max_pairs,
+             int n_max, const unsigned n_threads = default_n_threads()) {
+  std::vector<JunctionBox> jbs = read_file(input_file_name);
+  return evaluate_kd_tree(jbs, n_max_pairs, n_max, n_threads);
+}
+
+// Answers to both parts of the puzzle for the given input, using at most
+// n_threads threads.
+inline std::array<std::string, 2>
+solve(const std::string input_file_name,
+      const unsigned n_threads = default_n_threads()) {
+  std::pair<int, long long> result =
+      process_file(input_file_name, 1000, 3, n_threads);
+  return {std::to_string(result.first), std::to_string(result.second)};
+}
+
+} // namespace day08
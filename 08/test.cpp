@@ -0,0 +1,303 @@
+#undef NDEBUG
+#include <cassert>
+#include <iostream>
+
+#include "solver.hpp"
+
+using namespace day08;
+
+int main() {
+  std::cout << "Running unit tests ..." << std::endl;
+
+  std::vector<JunctionBox> jbs{
+      JunctionBox({1, 2, 3}, -1),
+      JunctionBox({4, 5, 6}, -2),
+      JunctionBox({7, 8, 10}, -3),
+  };
+  std::pmr::vector<Distance> dis = evaluate_distances(jbs);
+  assert(dis[0].value == 27.0);
+  assert(dis[0].jb1 == 0);
+  assert(dis[0].jb2 == 1);
+  assert(dis[1].value == 121.0);
+  assert(dis[1].jb1 == 0);
+  assert(dis[1].jb2 == 2);
+  assert(dis[2].value == 34.0);
+  assert(dis[2].jb1 == 1);
+  assert(dis[2].jb2 == 2);
+
+  std::sort(dis.begin(), dis.end());
+  assert(dis[0].value == 27.0);
+  assert(dis[1].value == 34.0);
+  assert(dis[2].value == 121.0);
+
+  jbs = {
+      JunctionBox({100, 0, 0}, -1), JunctionBox({6, 0, 0}, -2),
+      JunctionBox({120, 0, 0}, -3), JunctionBox({4, 0, 0}, -4),
+      JunctionBox({150, 0, 0}, -5), JunctionBox({0, 0, 0}, -6),
+      JunctionBox({1, 0, 0}, -7),
+  };
+  dis = evaluate_distances(jbs);
+  evaluate_circuits(dis, jbs, 2);
+  assert(jbs[0].circuit == -1);
+  assert(jbs[1].circuit == 1);
+  assert(jbs[2].circuit == -3);
+  assert(jbs[3].circuit == 1);
+  assert(jbs[4].circuit == -5);
+  assert(jbs[5].circuit == 0);
+  assert(jbs[6].circuit == 0);
+  reset_circuits(jbs);
+  evaluate_circuits(dis, jbs, 3);
+  assert(jbs[0].circuit == -1);
+  assert(jbs[1].circuit == 0);
+  assert(jbs[2].circuit == -3);
+  assert(jbs[3].circuit == 0);
+  assert(jbs[4].circuit == -5);
+  assert(jbs[5].circuit == 0);
+  assert(jbs[6].circuit == 0);
+  reset_circuits(jbs);
+  evaluate_circuits(dis, jbs, 4);
+  assert(jbs[0].circuit == -1);
+  assert(jbs[1].circuit == 0);
+  assert(jbs[2].circuit == -3);
+  assert(jbs[3].circuit == 0);
+  assert(jbs[4].circuit == -5);
+  assert(jbs[5].circuit == 0);
+  assert(jbs[6].circuit == 0);
+  reset_circuits(jbs);
+  evaluate_circuits(dis, jbs, 7);
+  assert(jbs[0].circuit == 2);
+  assert(jbs[1].circuit == 0);
+  assert(jbs[2].circuit == 2);
+  assert(jbs[3].circuit == 0);
+  assert(jbs[4].circuit == -5);
+  assert(jbs[5].circuit == 0);
+  assert(jbs[6].circuit == 0);
+
+  std::sort(dis.begin(), dis.end());
+  CircuitTracker tracker(jbs.size());
+  for (size_t n = 0; n < 7; ++n) {
+    tracker.unite(dis[n].jb1, dis[n].jb2);
+  }
+  assert(tracker.find(1) == tracker.find(3));
+  assert(tracker.find(1) == tracker.find(5));
+  assert(tracker.find(1) == tracker.find(6));
+  assert(tracker.find(0) == tracker.find(2));
+  assert(tracker.find(0) != tracker.find(1));
+  assert(tracker.find(4) == 4);
+  assert(tracker.n_circuits == 3);
+  assert((tracker.size_histogram == std::map<int, int>{{2, 1}, {4, 1}}));
+  assert(tracker.score(1) == 4);
+  assert(tracker.score(2) == 8);
+  assert(tracker.score(3) == 8);
+  assert(!tracker.unite(3, 6));
+
+  std::vector<std::pair<int, int>> circuit_stats =
+      count_circuits(std::vector<JunctionBox>{
+          JunctionBox({0, 0, 0}, -1), JunctionBox({0, 0, 0}, -1),
+          JunctionBox({0, 0, 0}, -1), JunctionBox({0, 0, 0}, -1),
+          JunctionBox({0, 0, 0}, -1), JunctionBox({0, 0, 0}, 1),
+          JunctionBox({0, 0, 0}, 1), JunctionBox({0, 0, 0}, 1),
+          JunctionBox({0, 0, 0}, 100), JunctionBox({0, 0, 0}, 100)});
+  assert(circuit_stats.size() == 3);
+  assert(circuit_stats[0].second == -1);
+  assert(circuit_stats[0].first == 5);
+  assert(circuit_stats[1].second == 1);
+  assert(circuit_stats[1].first == 3);
+  assert(circuit_stats[2].second == 100);
+  assert(circuit_stats[2].first == 2);
+
+  assert(score(circuit_stats, 1) == 3);
+  assert(score(circuit_stats, 2) == 6);
+  assert(score(circuit_stats, 3) == 6);
+
+  std::cout << "\tUnits tests completed successfully." << std::endl;
+
+  std::cout << "Running AOC test ..." << std::endl;
+  std::vector<JunctionBox> example_jbs = {
+      JunctionBox({162, 817, 812}), JunctionBox({57, 618, 57}),
+      JunctionBox({906, 360, 560}), JunctionBox({592, 479, 940}),
+      JunctionBox({352, 342, 300}), JunctionBox({466, 668, 158}),
+      JunctionBox({542, 29, 236}),  JunctionBox({431, 825, 988}),
+      JunctionBox({739, 650, 466}), JunctionBox({52, 470, 668}),
+      JunctionBox({216, 146, 977}), JunctionBox({819, 987, 18}),
+      JunctionBox({117, 168, 530}), JunctionBox({805, 96, 715}),
+      JunctionBox({346, 949, 466}), JunctionBox({970, 615, 88}),
+      JunctionBox({941, 993, 340}), JunctionBox({862, 61, 35}),
+      JunctionBox({984, 92, 344}),  JunctionBox({425, 690, 689})};
+  std::pmr::vector<Distance> example_dis = evaluate_distances(example_jbs);
+  std::sort(example_dis.begin(), example_dis.end());
+
+  std::pair<int, long long> example_result = evaluate(example_jbs, 10, 3);
+  assert(example_result.first == 40);
+  assert(example_result.second == 25272);
+
+  for (size_t n_pairs : {0, 1, 10, 50, 190, 1000}) {
+    std::vector<Distance> example_shortest_dis =
+        shortest_distances(example_jbs, n_pairs);
+    assert(example_shortest_dis.size() ==
+           std::min(n_pairs, example_dis.size()));
+    for (size_t i = 0; i < example_shortest_dis.size(); ++i) {
+      assert(example_shortest_dis[i].value == example_dis[i].value);
+      assert(distance(example_jbs[example_shortest_dis[i].jb1],
+                      example_jbs[example_shortest_dis[i].jb2]) ==
+             example_dis[i].value);
+      assert(example_shortest_dis[i].jb1 < example_shortest_dis[i].jb2);
+    }
+  }
+  assert(evaluate_nearest_circuits(example_jbs, 10, 3) == 40);
+
+  std::pair<int, long long> example_kruskal_result =
+      evaluate_kruskal(example_jbs, 10, 3);
+  assert(example_kruskal_result.first == 40);
+  assert(example_kruskal_result.second == 25272);
+  assert(connect_circuits(example_jbs, example_dis, 0, 3).first == 1);
+  assert(connect_circuits(example_jbs, example_dis, 1000, 1).first == 20);
+  assert(connect_circuits(example_jbs, example_dis, 1000, 1).second == 25272);
+  for (unsigned n_threads : {1, 2, 3, 8}) {
+    assert(find_last_connection_emst(example_jbs, n_threads) == 25272);
+  }
+
+  Positions example_positions(example_jbs);
+  EdgeKeyLayout example_layout(example_positions);
+  std::vector<std::uint64_t> example_keys =
+      evaluate_edge_keys(example_positions, example_layout, 2);
+  std::pmr::vector<Distance> example_unsorted_dis =
+      evaluate_distances(example_jbs);
+  assert(example_keys.size() == example_unsorted_dis.size());
+  for (size_t i = 0; i < example_keys.size(); ++i) {
+    assert(example_layout.distance(example_keys[i]) ==
+           example_unsorted_dis[i].value);
+    assert(example_layout.jb1(example_keys[i]) ==
+           example_unsorted_dis[i].jb1);
+    assert(example_layout.jb2(example_keys[i]) ==
+           example_unsorted_dis[i].jb2);
+  }
+  for (unsigned n_threads : {1, 4}) {
+    example_kruskal_result = evaluate_packed(example_jbs, 10, 3, n_threads);
+    assert(example_kruskal_result.first == 40);
+    assert(example_kruskal_result.second == 25272);
+  }
+  std::mt19937_64 generator(8);
+  for (size_t n_keys : {0, 1, 1000, 100000}) {
+    std::vector<std::uint64_t> random_keys(n_keys);
+    for (auto &key : random_keys) {
+      key = generator() >> 4;
+    }
+    std::vector<std::uint64_t> sorted_keys = random_keys;
+    std::sort(sorted_keys.begin(), sorted_keys.end());
+    for (unsigned n_threads : {1, 3}) {
+      std::vector<std::uint64_t> radix_sorted_keys = random_keys;
+      radix_sort(radix_sorted_keys, 60, n_threads);
+      assert(radix_sorted_keys == sorted_keys);
+    }
+  }
+
+  example_result = evaluate_kd_tree(example_jbs, 10, 3);
+  assert(example_result.first == 40);
+  assert(example_result.second == 25272);
+
+  // The product of the x coordinates of the last connection exceeds INT_MAX.
+  std::vector<JunctionBox> far_jbs{JunctionBox({50000, 0, 0}),
+                                   JunctionBox({50001, 0, 0}),
+                                   JunctionBox({90000, 0, 0})};
+  assert(evaluate(far_jbs, 1, 1).second == 4500090000ll);
+  assert(evaluate_kruskal(far_jbs, 1, 1).second == 4500090000ll);
+  assert(evaluate_packed(far_jbs, 1, 1).second == 4500090000ll);
+  assert(evaluate_kd_tree(far_jbs, 1, 1).second == 4500090000ll);
+
+  assert(squared_distance({-1500000000, 0, 0}, {1500000000, 0, 0}) ==
+         9000000000000000000ll);
+  std::vector<JunctionBox> wide_jbs{JunctionBox({-max_coordinate, 0, 0}),
+                                    JunctionBox({max_coordinate - 1, 0, 0}),
+                                    JunctionBox({max_coordinate, 0, 0})};
+  assert(evaluate_kd_tree(wide_jbs, 1, 1) ==
+         std::make_pair(2, -(long long)max_coordinate * (max_coordinate - 1)));
+  assert(evaluate_kruskal(wide_jbs, 1, 1) == evaluate_kd_tree(wide_jbs, 1, 1));
+
+  bool out_of_range = false;
+  try {
+    JunctionBox({0, max_coordinate + 1, 0});
+  } catch (const std::out_of_range &) {
+    out_of_range = true;
+  }
+  assert(out_of_range);
+  out_of_range = false;
+  try {
+    JunctionBox({0, 0, -max_coordinate - 1});
+  } catch (const std::out_of_range &) {
+    out_of_range = true;
+  }
+  assert(out_of_range);
+
+  bool overflow_detected = false;
+  try {
+    EdgeKeyLayout(Positions(
+        {JunctionBox({-max_coordinate, -max_coordinate, -max_coordinate}),
+         JunctionBox({max_coordinate, max_coordinate, max_coordinate})}));
+  } catch (const std::overflow_error &) {
+    overflow_detected = true;
+  }
+  assert(overflow_detected);
+
+  // The squared extents add up to just above 2^64. Such coordinates cannot
+  // come from junction boxes, so they are written into the layout directly.
+  overflow_detected = false;
+  Positions wrapping_positions({});
+  wrapping_positions.x = {-1518500250, 1518500250};
+  wrapping_positions.y = {-1518500250, 1518500250};
+  wrapping_positions.z = {0, 0};
+  try {
+    EdgeKeyLayout{wrapping_positions};
+  } catch (const std::overflow_error &) {
+    overflow_detected = true;
+  }
+  assert(overflow_detected);
+
+  // The all-pairs reference has to agree with Kruskal on random boxes.
+  std::vector<JunctionBox> random_jbs;
+  for (int n_random = 0; n_random < 300; ++n_random) {
+    random_jbs.clear();
+    for (size_t i = 0; i < 2 + generator() % 15; ++i) {
+      random_jbs.push_back(JunctionBox({(int)(generator() % 1000),
+                                        (int)(generator() % 1000),
+                                        (int)(generator() % 1000)}));
+    }
+    for (int n_pairs : {1, 4, 10}) {
+      assert(evaluate(random_jbs, n_pairs, 3) ==
+             evaluate_kruskal(random_jbs, n_pairs, 3));
+    }
+  }
+
+  // Many equal distances on a small grid: the pairs that are chosen for part
+  // 1 and the last connection must not depend on the engine.
+  std::vector<JunctionBox> tied_jbs;
+  for (int n_tied = 0; n_tied < 200; ++n_tied) {
+    tied_jbs.clear();
+    for (int i = 0; i < 12; ++i) {
+      tied_jbs.push_back(JunctionBox(
+          {(int)(generator() % 4), (int)(generator() % 4), 0}));
+    }
+    for (int n_pairs : {1, 3, 5, 10, 20}) {
+      assert(evaluate_kd_tree(tied_jbs, n_pairs, 3) ==
+             evaluate_packed(tied_jbs, n_pairs, 3));
+      assert(evaluate_kruskal(tied_jbs, n_pairs, 3) ==
+             evaluate_packed(tied_jbs, n_pairs, 3));
+    }
+  }
+
+  example_jbs = read_file("input_test.txt");
+  assert(example_jbs[0].position[0] == 162);
+  assert(example_jbs[0].position[1] == 817);
+  assert(example_jbs[0].position[2] == 812);
+  assert(example_jbs.back().position[0] == 425);
+  assert(example_jbs.back().position[1] == 690);
+  assert(example_jbs.back().position[2] == 689);
+
+  example_result = process_file("input_test.txt", 10, 3);
+  assert(example_result.first == 40);
+  assert(example_result.second == 25272);
+
+  std::cout << "\tAOC test completed successfully." << std::endl;
+
+  return 0;
+}
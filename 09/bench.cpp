@@ -0,0 +1,34 @@
+#include "common/bench.hpp"
+#include "solver.hpp"
+
+using namespace day09;
+
+int main(int argc, char *argv[]) {
+  aoc::Benchmark benchmark("09", argc, argv);
+  const std::string input_file_name = benchmark.input_file_name;
+  const std::vector<std::pair<long long, long long>> tiles =
+      read_file(input_file_name);
+  const Polygon polygon(tiles);
+
+  benchmark.add("read_file", [&]() {
+    aoc::do_not_optimize(read_file(input_file_name));
+  });
+  benchmark.add("largest_area",
+                [&]() { aoc::do_not_optimize(largest_area(tiles)); });
+  benchmark.add("largest_area_inside",
+                [&]() { aoc::do_not_optimize(largest_area(tiles, true)); });
+  benchmark.add("largest_area_staircase", [&]() {
+    aoc::do_not_optimize(largest_area_staircase(tiles));
+  });
+  benchmark.add("largest_area_pruned_inside", [&]() {
+    aoc::do_not_optimize(largest_area_parallel(tiles, true, 1));
+  });
+  benchmark.add("largest_area_branch_and_bound", [&]() {
+    aoc::do_not_optimize(largest_area_branch_and_bound(tiles));
+  });
+  benchmark.add("polygon", [&]() { aoc::do_not_optimize(Polygon(tiles)); });
+  benchmark.add("polygon_largest_area_inside",
+                [&]() { aoc::do_not_optimize(polygon.largest_area(true)); });
+
+  return benchmark.run();
+}
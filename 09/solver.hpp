@@ -0,0 +1,862 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory_resource>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "common/input.hpp"
+#include "common/instrument.hpp"
+#include "common/memory.hpp"
+
+namespace day09 {
+
+inline long long area(const std::pair<long long, long long> tile_1,
+                      const std::pair<long long, long long> tile_2) {
+  return (llabs(tile_1.first - tile_2.first) + 1) *
+         (llabs(tile_1.second - tile_2.second) + 1);
+}
+
+enum Direction { left, right, up, down };
+
+inline Direction get_direction(std::pair<long long, long long> tile_1,
+                               std::pair<long long, long long> tile_2) {
+  if (tile_1.first == tile_2.first) {
+    if (tile_1.second < tile_2.second) {
+      return Direction::down;
+    }
+    return Direction::up;
+  }
+  if (tile_1.second == tile_2.second) {
+    if (tile_1.first < tile_2.first) {
+      return Direction::right;
+    }
+    return Direction::left;
+  }
+  return Direction::left;
+}
+
+inline int get_curvature(std::pair<long long, long long> tile_1,
+                         std::pair<long long, long long> tile_2,
+                         std::pair<long long, long long> tile_3) {
+  Direction d1 = get_direction(tile_1, tile_2);
+  Direction d2 = get_direction(tile_2, tile_3);
+  if (d1 == d2) {
+    return 0;
+  }
+  switch (d1) {
+  case left:
+    switch (d2) {
+    case up:
+      return 1;
+    case down:
+      return -1;
+    }
+  case right:
+    switch (d2) {
+    case up:
+      return -1;
+    case down:
+      return 1;
+    }
+  case up:
+    switch (d2) {
+    case left:
+      return -1;
+    case right:
+      return 1;
+    }
+  case down:
+    switch (d2) {
+    case left:
+      return 1;
+    case right:
+      return -1;
+    }
+  }
+  return 0;
+}
+
+inline std::vector<int>
+evaluate_curvature(const std::vector<std::pair<long long, long long>> tiles) {
+  std::vector<int> result(tiles.size(), 0);
+  int direction;
+
+  result[0] = get_curvature(tiles.back(), tiles[0], tiles[1]);
+  for (size_t i = 1; i < tiles.size(); ++i) {
+    result[i] =
+        get_curvature(tiles[i - 1], tiles[i], tiles[(i + 1) % tiles.size()]);
+  }
+
+  return result;
+}
+
+inline bool
+point_is_inside(const std::pair<long long, long long> point,
+                const std::vector<std::pair<long long, long long>> tiles,
+                const std::vector<int> curvature) {
+  AOC_COUNT("09/point_is_inside");
+  int n_intersections = 0;
+  for (size_t i = 0; i < tiles.size() - 1; ++i) {
+    if (tiles[i].second == tiles[i + 1].second) {
+      if (point.second == tiles[i].second) {
+        if ((point.first >= std::min(tiles[i].first, tiles[i + 1].first)) &&
+            (point.first <= std::max(tiles[i].first, tiles[i + 1].first))) {
+          return true;
+        } else {
+          if (point.first < std::min(tiles[i].first, tiles[i + 1].first) &&
+              curvature[i] != curvature[i + 1]) {
+            ++n_intersections;
+          }
+        }
+      }
+    } else if (point.first == tiles[i].first &&
+               (point.second >=
+                std::min(tiles[i].second, tiles[i + 1].second)) &&
+               (point.second <=
+                std::max(tiles[i].second, tiles[i + 1].second))) {
+      return true;
+    } else if (point.first < tiles[i].first &&
+               point.second >= std::min(tiles[i].second, tiles[i + 1].second) &&
+               point.second <= std::max(tiles[i].second, tiles[i + 1].second)) {
+      ++n_intersections;
+    }
+  }
+  if (tiles.back().second == tiles[0].second) {
+    if (point.second == tiles.back().second) {
+      if (point.first >= std::min(tiles.back().first, tiles[0].first) &&
+          point.first <= std::max(tiles.back().first, tiles[0].first)) {
+        return true;
+      } else {
+        if (point.first < std::min(tiles.back().first, tiles[0].first) &&
+            curvature.back() != curvature[0]) {
+          ++n_intersections;
+        }
+      }
+    }
+  } else if (point.first == tiles.back().first &&
+             (point.second >= std::min(tiles.back().second, tiles[0].second)) &&
+             (point.second <= std::max(tiles.back().second, tiles[0].second))) {
+    return true;
+  } else if (point.first < tiles[0].first &&
+             point.second >= std::min(tiles.back().second, tiles[0].second) &&
+             point.second <= std::max(tiles.back().second, tiles[0].second)) {
+    ++n_intersections;
+  }
+  if (n_intersections % 2 == 0) {
+    return false;
+  }
+  return true;
+}
+
+inline std::vector<long long>
+axis_coordinates(const std::vector<std::pair<long long, long long>> &tiles,
+                 const bool x) {
+  std::vector<long long> result;
+  for (auto tile : tiles) {
+    result.push_back(x ? tile.first : tile.second);
+  }
+  return result;
+}
+
+inline std::vector<std::pair<long long, long long>>
+transpose(const std::vector<std::pair<long long, long long>> &tiles) {
+  std::vector<std::pair<long long, long long>> result;
+  for (auto tile : tiles) {
+    result.push_back({tile.second, tile.first});
+  }
+  return result;
+}
+
+// Compressed coordinate axis: entry 2 * i is the coordinate values[i], and
+// entry 2 * i + 1 stands for all coordinates strictly between values[i] and
+// values[i + 1]. Empty gaps are left out, so every entry covers at least one
+// tile.
+struct CompressedAxis {
+  std::vector<long long> values;
+  std::vector<int> entries;
+  int n_entries;
+
+  CompressedAxis(std::vector<long long> coordinates) {
+    std::sort(coordinates.begin(), coordinates.end());
+    coordinates.erase(std::unique(coordinates.begin(), coordinates.end()),
+                      coordinates.end());
+    values = coordinates;
+    n_entries = 0;
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (i > 0 && values[i] - values[i - 1] > 1) {
+        ++n_entries;
+      }
+      entries.push_back(n_entries++);
+    }
+  }
+
+  int entry(const long long coordinate) const {
+    return entries[std::lower_bound(values.begin(), values.end(), coordinate) -
+                   values.begin()];
+  }
+};
+
+using Intervals = std::pmr::vector<std::pair<long long, long long>>;
+
+// Sorts the intervals and merges the ones that overlap or touch, in place.
+inline void merge_intervals(Intervals &intervals) {
+  std::sort(intervals.begin(), intervals.end());
+  size_t n_merged = 0;
+  for (auto interval : intervals) {
+    if (n_merged > 0 && interval.first <= intervals[n_merged - 1].second + 1) {
+      intervals[n_merged - 1].second =
+          std::max(intervals[n_merged - 1].second, interval.second);
+    } else {
+      intervals[n_merged++] = interval;
+    }
+  }
+  intervals.resize(n_merged);
+}
+
+// Sorted inside intervals [x_min, x_max] of the polygon for every row of the
+// compressed y axis. The rows are built in one sweep over the vertical edges:
+// just above and below a vertex row, the vertical edges that cross the row
+// pair up into inside intervals, and the row itself adds its horizontal edges.
+// The rows are allocated from the given resource, the sweep itself from an
+// arena that is released at the end of the constructor.
+struct ScanlineIndex {
+  CompressedAxis y_axis;
+  std::pmr::vector<Intervals> rows;
+
+  ScanlineIndex(
+      const std::vector<std::pair<long long, long long>> &tiles,
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+      : y_axis(axis_coordinates(tiles, false)),
+        rows(y_axis.n_entries, resource) {
+    AOC_PHASE("09/scanline_index");
+    aoc::Arena sweep("09/scanline_sweep");
+    using Edges = std::pmr::vector<std::tuple<long long, long long, long long>>;
+    Edges starts(sweep.resource()), ends(sweep.resource()),
+        horizontal_edges(sweep.resource());
+    for (size_t i = 0; i < tiles.size(); ++i) {
+      auto [y1, y2] = std::minmax(tiles[i].second,
+                                  tiles[(i + 1) % tiles.size()].second);
+      auto [x1, x2] = std::minmax(tiles[i].first,
+                                  tiles[(i + 1) % tiles.size()].first);
+      if (x1 == x2) {
+        starts.push_back({y1, x1, 0});
+        ends.push_back({y2, x1, 0});
+      } else {
+        horizontal_edges.push_back({y1, x1, x2});
+      }
+    }
+    std::sort(starts.begin(), starts.end());
+    std::sort(ends.begin(), ends.end());
+    std::sort(horizontal_edges.begin(), horizontal_edges.end());
+    std::pmr::multiset<long long> crossings(sweep.resource());
+    size_t n_start = 0, n_end = 0, n_horizontal = 0;
+    Intervals row(sweep.resource()), below(sweep.resource());
+    long long y;
+    for (size_t n_row = 0; n_row < y_axis.values.size(); ++n_row) {
+      y = y_axis.values[n_row];
+      row.clear();
+      add_crossing_intervals(crossings, row);
+      for (; n_end < ends.size() && std::get<0>(ends[n_end]) == y; ++n_end) {
+        crossings.erase(crossings.find(std::get<1>(ends[n_end])));
+      }
+      for (; n_start < starts.size() && std::get<0>(starts[n_start]) == y;
+           ++n_start) {
+        crossings.insert(std::get<1>(starts[n_start]));
+      }
+      for (; n_horizontal < horizontal_edges.size() &&
+             std::get<0>(horizontal_edges[n_horizontal]) == y;
+           ++n_horizontal) {
+        row.push_back({std::get<1>(horizontal_edges[n_horizontal]),
+                       std::get<2>(horizontal_edges[n_horizontal])});
+      }
+      below.clear();
+      add_crossing_intervals(crossings, below);
+      row.insert(row.end(), below.begin(), below.end());
+      merge_intervals(row);
+      rows[y_axis.entries[n_row]].assign(row.begin(), row.end());
+      if (n_row + 1 < y_axis.values.size() &&
+          y_axis.entries[n_row + 1] > y_axis.entries[n_row] + 1) {
+        merge_intervals(below);
+        rows[y_axis.entries[n_row] + 1].assign(below.begin(), below.end());
+      }
+    }
+  }
+
+  static void add_crossing_intervals(
+      const std::pmr::multiset<long long> &crossings, Intervals &intervals) {
+    for (auto it = crossings.begin(); it != crossings.end(); ++it) {
+      long long first = *it;
+      intervals.push_back({first, *++it});
+    }
+  }
+
+  // Row of the compressed axis that contains y, or -1.
+  int row_entry(const long long y) const {
+    if (y_axis.values.empty() || y < y_axis.values.front() ||
+        y > y_axis.values.back()) {
+      return -1;
+    }
+    size_t i = std::lower_bound(y_axis.values.begin(), y_axis.values.end(), y) -
+               y_axis.values.begin();
+    return y_axis.values[i] == y ? y_axis.entries[i] : y_axis.entries[i] - 1;
+  }
+
+  // Inside interval of row y that contains x. If there is none, the interval
+  // is empty, with its first end above its second.
+  std::pair<long long, long long> interval(const long long x,
+                                           const long long y) const {
+    const std::pair<long long, long long> none{
+        std::numeric_limits<long long>::max(),
+        std::numeric_limits<long long>::min()};
+    const int entry = row_entry(y);
+    if (entry < 0) {
+      return none;
+    }
+    const Intervals &row = rows[entry];
+    auto it = std::upper_bound(
+        row.begin(), row.end(), x,
+        [](const long long x, const std::pair<long long, long long> &interval) {
+          return x < interval.first;
+        });
+    return it != row.begin() && x <= std::prev(it)->second ? *std::prev(it)
+                                                           : none;
+  }
+
+  bool contains_segment(const long long x1, const long long x2,
+                        const long long y) const {
+    return x2 <= interval(x1, y).second;
+  }
+
+  bool contains(const std::pair<long long, long long> point) const {
+    return contains_segment(point.first, point.first, point.second);
+  }
+};
+
+// The boundary of the rectangle is checked with four segment queries. This is
+// sufficient, because a tile outside the polygon cannot be enclosed by tiles
+// inside it.
+inline bool rectangle_is_inside(const std::pair<long long, long long> tile_1,
+                                const std::pair<long long, long long> tile_2,
+                                const ScanlineIndex &rows,
+                                const ScanlineIndex &columns) {
+  AOC_COUNT("09/rectangle_is_inside");
+  std::pair<long long, long long> x = std::minmax(tile_1.first, tile_2.first);
+  std::pair<long long, long long> y = std::minmax(tile_1.second, tile_2.second);
+  return rows.contains_segment(x.first, x.second, y.first) &&
+         rows.contains_segment(x.first, x.second, y.second) &&
+         columns.contains_segment(y.first, y.second, x.first) &&
+         columns.contains_segment(y.first, y.second, x.second);
+}
+
+// Counts finished pairs from any number of threads and prints the progress to
+// std::cerr at most once per interval.
+struct ProgressReporter {
+  const size_t n_total;
+  const std::chrono::steady_clock::duration interval;
+  std::atomic<size_t> n_done;
+  std::chrono::steady_clock::time_point next_report;
+  std::mutex mutex;
+
+  ProgressReporter(const size_t n_total,
+                   const std::chrono::steady_clock::duration interval =
+                       std::chrono::seconds(1))
+      : n_total(n_total), interval(interval), n_done(0),
+        next_report(std::chrono::steady_clock::now() + interval) {}
+
+  void add(const size_t n) {
+    const size_t n_done_now = n_done += n;
+    std::unique_lock<std::mutex> lock(mutex, std::try_to_lock);
+    if (lock.owns_lock() && std::chrono::steady_clock::now() >= next_report) {
+      std::cerr << n_done_now << " / " << n_total << "\n";
+      next_report = std::chrono::steady_clock::now() + interval;
+    }
+  }
+};
+
+inline long long
+largest_area(const std::vector<std::pair<long long, long long>> tiles,
+             const bool inside = false) {
+  long long result = 0ll;
+  long long current_area;
+  bool calculate = false;
+  ScanlineIndex rows(inside ? tiles
+                            : std::vector<std::pair<long long, long long>>{});
+  ScanlineIndex columns(
+      inside ? transpose(tiles)
+             : std::vector<std::pair<long long, long long>>{});
+  ProgressReporter progress(tiles.size() * (tiles.size() - 1) / 2);
+  for (size_t i = 0; i < tiles.size(); ++i) {
+    progress.add(tiles.size() - i - 1);
+    for (size_t j = i + 1; j < tiles.size(); ++j) {
+      calculate =
+          inside ? rectangle_is_inside(tiles[i], tiles[j], rows, columns)
+                 : true;
+      if (calculate) {
+        current_area = area(tiles[i], tiles[j]);
+        if (current_area > result) {
+          result = current_area;
+        }
+      }
+    }
+  }
+  return result;
+}
+
+// The polygon rasterized on the compressed grid. Boundary cells are drawn
+// along the edges, the outside is flood-filled from a frame around the grid,
+// and outside_sum holds the 2D prefix sum of the outside cells, so that a
+// rectangle is tested for containment in O(1).
+struct CompressedRaster {
+  CompressedAxis x_axis;
+  CompressedAxis y_axis;
+  std::vector<int> outside_sum;
+
+  CompressedRaster(const std::vector<std::pair<long long, long long>> tiles)
+      : x_axis(axis_coordinates(tiles, true)),
+        y_axis(axis_coordinates(tiles, false)) {
+    const int width = x_axis.n_entries + 2;
+    const int height = y_axis.n_entries + 2;
+    std::vector<char> cells(width * height, 0);
+    int x1, x2, y1, y2;
+    for (size_t i = 0; i < tiles.size(); ++i) {
+      std::tie(x1, x2) =
+          std::minmax(x_axis.entry(tiles[i].first) + 1,
+                      x_axis.entry(tiles[(i + 1) % tiles.size()].first) + 1);
+      std::tie(y1, y2) =
+          std::minmax(y_axis.entry(tiles[i].second) + 1,
+                      y_axis.entry(tiles[(i + 1) % tiles.size()].second) + 1);
+      for (int y = y1; y <= y2; ++y) {
+        for (int x = x1; x <= x2; ++x) {
+          cells[y * width + x] = 1;
+        }
+      }
+    }
+    std::vector<int> stack{0};
+    cells[0] = 2;
+    int cell, x, y;
+    while (!stack.empty()) {
+      cell = stack.back();
+      stack.pop_back();
+      x = cell % width;
+      y = cell / width;
+      for (int neighbor : {x > 0 ? cell - 1 : -1,
+                           x < width - 1 ? cell + 1 : -1,
+                           y > 0 ? cell - width : -1,
+                           y < height - 1 ? cell + width : -1}) {
+        if (neighbor >= 0 && cells[neighbor] == 0) {
+          cells[neighbor] = 2;
+          stack.push_back(neighbor);
+        }
+      }
+    }
+    outside_sum.assign((width + 1) * (height + 1), 0);
+    for (y = 0; y < height; ++y) {
+      for (x = 0; x < width; ++x) {
+        outside_sum[(y + 1) * (width + 1) + x + 1] =
+            (cells[y * width + x] == 2) + outside_sum[y * (width + 1) + x + 1] +
+            outside_sum[(y + 1) * (width + 1) + x] -
+            outside_sum[y * (width + 1) + x];
+      }
+    }
+  }
+
+  // Corners must be vertices of the polygon, or at least share their
+  // coordinates with vertices.
+  bool contains(const std::pair<long long, long long> tile_1,
+                const std::pair<long long, long long> tile_2) const {
+    const int width = x_axis.n_entries + 3;
+    int x1, x2, y1, y2;
+    std::tie(x1, x2) = std::minmax(x_axis.entry(tile_1.first) + 1,
+                                   x_axis.entry(tile_2.first) + 1);
+    std::tie(y1, y2) = std::minmax(y_axis.entry(tile_1.second) + 1,
+                                   y_axis.entry(tile_2.second) + 1);
+    return outside_sum[(y2 + 1) * width + x2 + 1] -
+               outside_sum[y1 * width + x2 + 1] -
+               outside_sum[(y2 + 1) * width + x1] +
+               outside_sum[y1 * width + x1] ==
+           0;
+  }
+};
+
+inline long long largest_area_compressed(
+    const std::vector<std::pair<long long, long long>> tiles) {
+  CompressedRaster raster(tiles);
+  long long result = 0ll;
+  long long current_area;
+  for (size_t i = 0; i < tiles.size(); ++i) {
+    for (size_t j = i + 1; j < tiles.size(); ++j) {
+      current_area = area(tiles[i], tiles[j]);
+      if (current_area > result && raster.contains(tiles[i], tiles[j])) {
+        result = current_area;
+      }
+    }
+  }
+  return result;
+}
+
+// Visits the candidate pairs in descending order of area and returns the first
+// one that is inside the polygon. A pair is a candidate if each tile lies in
+// the inside intervals of the row and the column through the other one, which
+// all edges of an inside rectangle do. Every tile i enters the heap with the
+// largest area it spans with a candidate j > i. Once that bound reaches the
+// top of the heap, the partners are handed out in sorted chunks of chunk_size,
+// each found with one pass over the tiles, so that memory stays linear in the
+// number of tiles. Tiles whose bound is below the answer are never expanded.
+// If given, n_checked_pairs is set to the number of containment checks.
+inline long long largest_area_branch_and_bound(
+    const std::vector<std::pair<long long, long long>> &tiles,
+    const ScanlineIndex &rows, const ScanlineIndex &columns,
+    size_t *n_checked_pairs = nullptr) {
+  AOC_PHASE("09/branch_and_bound");
+  const size_t chunk_size = 64;
+  const int n_tiles = tiles.size();
+  // (area, i, j) is the pair of tiles i and j, or for j = -1 the next chunk of
+  // partners of tile i, none of which spans more than area.
+  std::priority_queue<std::tuple<long long, int, int>> heap;
+  // Last (area, j) that was handed out for tile i. The chunks follow in
+  // descending order of (area, j), so ties in area are neither lost nor
+  // repeated.
+  std::vector<std::pair<long long, int>> last_partner(
+      n_tiles, {std::numeric_limits<long long>::max(), n_tiles});
+  std::vector<std::pair<long long, long long>> x_reach, y_reach;
+  for (auto tile : tiles) {
+    x_reach.push_back(rows.interval(tile.first, tile.second));
+    y_reach.push_back(columns.interval(tile.second, tile.first));
+  }
+  auto candidate = [&](const int i, const int j) {
+    return x_reach[i].first <= tiles[j].first &&
+           tiles[j].first <= x_reach[i].second &&
+           y_reach[i].first <= tiles[j].second &&
+           tiles[j].second <= y_reach[i].second &&
+           x_reach[j].first <= tiles[i].first &&
+           tiles[i].first <= x_reach[j].second &&
+           y_reach[j].first <= tiles[i].second &&
+           tiles[i].second <= y_reach[j].second;
+  };
+  long long bound;
+  for (int i = 0; i + 1 < n_tiles; ++i) {
+    bound = -1ll;
+    for (int j = i + 1; j < n_tiles; ++j) {
+      if (candidate(i, j)) {
+        bound = std::max(bound, area(tiles[i], tiles[j]));
+      }
+    }
+    if (bound >= 0) {
+      heap.push({bound, i, -1});
+    }
+  }
+  std::vector<std::pair<long long, int>> partners;
+  size_t n_checked = 0, n_chunk;
+  long long result = 0ll;
+  int i, j;
+  while (!heap.empty()) {
+    std::tie(bound, i, j) = heap.top();
+    heap.pop();
+    if (j >= 0) {
+      ++n_checked;
+      if (rectangle_is_inside(tiles[i], tiles[j], rows, columns)) {
+        result = bound;
+        break;
+      }
+      continue;
+    }
+    partners.clear();
+    for (int k = i + 1; k < n_tiles; ++k) {
+      if (!candidate(i, k)) {
+        continue;
+      }
+      std::pair<long long, int> partner{area(tiles[i], tiles[k]), k};
+      if (partner < last_partner[i]) {
+        partners.push_back(partner);
+      }
+    }
+    n_chunk = std::min(chunk_size, partners.size());
+    std::partial_sort(partners.begin(), partners.begin() + n_chunk,
+                      partners.end(), std::greater<>());
+    for (size_t k = 0; k < n_chunk; ++k) {
+      heap.push({partners[k].first, i, partners[k].second});
+    }
+    if (partners.size() > n_chunk) {
+      last_partner[i] = partners[n_chunk - 1];
+      heap.push({last_partner[i].first, i, -1});
+    }
+  }
+  if (n_checked_pairs) {
+    *n_checked_pairs = n_checked;
+  }
+  return result;
+}
+
+inline long long largest_area_branch_and_bound(
+    const std::vector<std::pair<long long, long long>> &tiles) {
+  if (tiles.size() < 2) {
+    return 0ll;
+  }
+  return largest_area_branch_and_bound(tiles, ScanlineIndex(tiles),
+                                       ScanlineIndex(transpose(tiles)));
+}
+
+// Tiles that have no other tile to their lower left, sorted by x ascending and
+// thus by y descending.
+inline std::vector<std::pair<long long, long long>>
+lower_left_staircase(std::vector<std::pair<long long, long long>> tiles) {
+  std::vector<std::pair<long long, long long>> result;
+  std::sort(tiles.begin(), tiles.end());
+  for (auto tile : tiles) {
+    if (result.empty() || tile.second < result.back().second) {
+      result.push_back(tile);
+    }
+  }
+  return result;
+}
+
+// Tiles that have no other tile to their upper right, sorted by x ascending
+// and thus by y descending.
+inline std::vector<std::pair<long long, long long>>
+upper_right_staircase(std::vector<std::pair<long long, long long>> tiles) {
+  std::vector<std::pair<long long, long long>> result;
+  std::sort(tiles.rbegin(), tiles.rend());
+  for (auto tile : tiles) {
+    if (result.empty() || tile.second > result.back().second) {
+      result.push_back(tile);
+    }
+  }
+  std::reverse(result.begin(), result.end());
+  return result;
+}
+
+// Largest area of a rectangle with its lower left corner in lower[lo, hi] and
+// its upper right corner in upper[first, last]. The best partner in upper is
+// monotonic in the index in lower, so the rows are solved by divide and
+// conquer. Pairs whose upper corner lies below and left of the lower one are
+// invalid and count as 0.
+inline long long
+staircase_area(const std::vector<std::pair<long long, long long>> &lower,
+               const std::vector<std::pair<long long, long long>> &upper,
+               const int lo, const int hi, const int first, const int last) {
+  if (lo > hi) {
+    return 0ll;
+  }
+  const int mid = (lo + hi) / 2;
+  long long result = std::numeric_limits<long long>::min();
+  long long current_area, dx, dy;
+  int best = first;
+  for (int j = first; j <= last; ++j) {
+    dx = upper[j].first - lower[mid].first + 1;
+    dy = upper[j].second - lower[mid].second + 1;
+    current_area = dx <= 0 && dy <= 0 ? 0ll : dx * dy;
+    if (current_area > result) {
+      result = current_area;
+      best = j;
+    }
+  }
+  return std::max({result,
+                   staircase_area(lower, upper, lo, mid - 1, first, best),
+                   staircase_area(lower, upper, mid + 1, hi, best, last)});
+}
+
+// Fast path for largest_area without the inside constraint. The largest
+// rectangle spans from the lower left to the upper right staircase, or, after
+// mirroring y, from the upper left to the lower right one.
+inline long long largest_area_staircase(
+    const std::vector<std::pair<long long, long long>> &tiles) {
+  AOC_PHASE("09/staircase");
+  if (tiles.size() < 2) {
+    return 0ll;
+  }
+  auto search = [](const std::vector<std::pair<long long, long long>> &points) {
+    std::vector<std::pair<long long, long long>> lower =
+        lower_left_staircase(points);
+    std::vector<std::pair<long long, long long>> upper =
+        upper_right_staircase(points);
+    return staircase_area(lower, upper, 0, lower.size() - 1, 0,
+                          upper.size() - 1);
+  };
+  std::vector<std::pair<long long, long long>> mirrored = tiles;
+  for (auto &tile : mirrored) {
+    tile.second = -tile.second;
+  }
+  return std::max(search(tiles), search(mirrored));
+}
+
+inline unsigned default_n_threads() {
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Same as largest_area, with the tiles i handed out to threads one at a time.
+// All threads share the best area found so far, so that pairs that cannot
+// beat it are skipped without a containment check.
+inline long long largest_area_parallel(
+    const std::vector<std::pair<long long, long long>> &tiles,
+    const bool inside = false, const unsigned n_threads = default_n_threads()) {
+  ScanlineIndex rows(inside ? tiles
+                            : std::vector<std::pair<long long, long long>>{});
+  ScanlineIndex columns(
+      inside ? transpose(tiles)
+             : std::vector<std::pair<long long, long long>>{});
+  ProgressReporter progress(tiles.size() * (tiles.size() - 1) / 2);
+  std::atomic<size_t> next_i{0};
+  std::atomic<long long> result{0ll};
+  auto worker = [&]() {
+    long long current_area, best;
+    for (size_t i = next_i++; i < tiles.size(); i = next_i++) {
+      for (size_t j = i + 1; j < tiles.size(); ++j) {
+        current_area = area(tiles[i], tiles[j]);
+        best = result.load(std::memory_order_relaxed);
+        if (current_area <= best ||
+            (inside &&
+             !rectangle_is_inside(tiles[i], tiles[j], rows, columns))) {
+          continue;
+        }
+        while (current_area > best &&
+               !result.compare_exchange_weak(best, current_area)) {
+        }
+      }
+      progress.add(tiles.size() - i - 1);
+    }
+  };
+  std::vector<std::thread> threads;
+  for (unsigned i = 1; i < n_threads; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  return result;
+}
+
+// Tests many segments (x1, x2, y) against one index. The segments are sorted
+// by row and x1, and every row is swept once, together with its intervals.
+inline std::vector<bool> contains_segments(
+    const ScanlineIndex &index,
+    const std::vector<std::tuple<long long, long long, long long>> &segments) {
+  std::vector<bool> result(segments.size(), false);
+  std::vector<std::pair<int, size_t>> order;
+  for (size_t i = 0; i < segments.size(); ++i) {
+    order.push_back({index.row_entry(std::get<2>(segments[i])), i});
+  }
+  std::sort(order.begin(), order.end(), [&](const auto &a, const auto &b) {
+    return std::tie(a.first, std::get<0>(segments[a.second])) <
+           std::tie(b.first, std::get<0>(segments[b.second]));
+  });
+  size_t n_interval = 0;
+  long long x1, x2;
+  for (size_t n = 0; n < order.size(); ++n) {
+    if (order[n].first < 0) {
+      continue;
+    }
+    const Intervals &row = index.rows[order[n].first];
+    if (n == 0 || order[n].first != order[n - 1].first) {
+      n_interval = 0;
+    }
+    std::tie(x1, x2, std::ignore) = segments[order[n].second];
+    while (n_interval < row.size() && row[n_interval].second < x1) {
+      ++n_interval;
+    }
+    result[order[n].second] = n_interval < row.size() &&
+                              row[n_interval].first <= x1 &&
+                              x2 <= row[n_interval].second;
+  }
+  return result;
+}
+
+// A tile polygon that is analyzed once and then answers many queries.
+// Rectangles are given by two opposite corner tiles, which do not need to be
+// vertices of the polygon. Both indices live in an arena that is released
+// together with the polygon.
+struct Polygon {
+  std::vector<std::pair<long long, long long>> tiles;
+  aoc::Arena arena;
+  ScanlineIndex rows;
+  ScanlineIndex columns;
+
+  Polygon(const std::vector<std::pair<long long, long long>> tiles)
+      : tiles(tiles), arena("09/polygon"), rows(tiles, arena.resource()),
+        columns(transpose(tiles), arena.resource()) {}
+
+  bool contains(const std::pair<long long, long long> point) const {
+    return rows.contains(point);
+  }
+
+  bool contains(const std::pair<long long, long long> tile_1,
+                const std::pair<long long, long long> tile_2) const {
+    return rectangle_is_inside(tile_1, tile_2, rows, columns);
+  }
+
+  std::vector<bool>
+  contains(const std::vector<std::pair<std::pair<long long, long long>,
+                                       std::pair<long long, long long>>>
+               &rectangles) const {
+    std::vector<std::tuple<long long, long long, long long>> horizontal,
+        vertical;
+    long long x1, x2, y1, y2;
+    for (auto rectangle : rectangles) {
+      std::tie(x1, x2) =
+          std::minmax(rectangle.first.first, rectangle.second.first);
+      std::tie(y1, y2) =
+          std::minmax(rectangle.first.second, rectangle.second.second);
+      horizontal.push_back({x1, x2, y1});
+      horizontal.push_back({x1, x2, y2});
+      vertical.push_back({y1, y2, x1});
+      vertical.push_back({y1, y2, x2});
+    }
+    std::vector<bool> horizontal_result = contains_segments(rows, horizontal);
+    std::vector<bool> vertical_result = contains_segments(columns, vertical);
+    std::vector<bool> result(rectangles.size());
+    for (size_t i = 0; i < rectangles.size(); ++i) {
+      result[i] = horizontal_result[2 * i] && horizontal_result[2 * i + 1] &&
+                  vertical_result[2 * i] && vertical_result[2 * i + 1];
+    }
+    return result;
+  }
+
+  // Inside the polygon, branch and bound is compared with the pruned scan
+  // largest_area_pruned_inside in bench09. It only stays here while it wins.
+  long long largest_area(const bool inside = false) const {
+    return inside ? largest_area_branch_and_bound(tiles, rows, columns)
+                  : largest_area_staircase(tiles);
+  }
+};
+
+inline std::vector<std::pair<long long, long long>>
+read_file(const std::string input_file_name) {
+  AOC_PHASE("09/read_file");
+  std::vector<std::pair<long long, long long>> result;
+  const std::string input = aoc::read_input(input_file_name);
+  aoc::LineReader lines(input);
+  std::string_view line;
+  size_t comma;
+  while (lines.next(line)) {
+    comma = line.find(',');
+    result.push_back({aoc::parse_integer<long long>(line.substr(0, comma)),
+                      aoc::parse_integer<long long>(line.substr(comma + 1))});
+  }
+  return result;
+}
+
+// Answers to both parts of the puzzle for the given input.
+inline std::array<std::string, 2> solve(const std::string input_file_name) {
+  Polygon polygon(read_file(input_file_name));
+  return {std::to_string(polygon.largest_area()),
+          std::to_string(polygon.largest_area(true))};
+}
+
+} // namespace day09
@@ -0,0 +1,265 @@
+#undef NDEBUG
+#include <cassert>
+#include <iostream>
+
+#include "solver.hpp"
+
+using namespace day09;
+
+// Inside tiles of the polygon in [0, width) x [0, height), rasterized
+// independently of the solver: a tile is inside if it lies on an edge, or if a
+// ray to the right crosses an odd number of vertical edges, each of which
+// covers the half-open range [y_min, y_max).
+std::vector<std::vector<bool>>
+rasterize(const std::vector<std::pair<long long, long long>> &tiles,
+          const long long width, const long long height) {
+  std::vector<std::vector<bool>> result(width, std::vector<bool>(height));
+  for (long long x = 0; x < width; ++x) {
+    for (long long y = 0; y < height; ++y) {
+      bool on_edge = false, inside = false;
+      for (size_t i = 0; i < tiles.size(); ++i) {
+        auto [x1, x2] = std::minmax(tiles[i].first,
+                                    tiles[(i + 1) % tiles.size()].first);
+        auto [y1, y2] = std::minmax(tiles[i].second,
+                                    tiles[(i + 1) % tiles.size()].second);
+        on_edge |= x1 <= x && x <= x2 && y1 <= y && y <= y2;
+        if (x1 == x2 && x < x1 && y1 <= y && y < y2) {
+          inside = !inside;
+        }
+      }
+      result[x][y] = on_edge || inside;
+    }
+  }
+  return result;
+}
+
+bool rectangle_is_inside(const std::vector<std::vector<bool>> &raster,
+                         const std::pair<long long, long long> tile_1,
+                         const std::pair<long long, long long> tile_2) {
+  for (long long x = std::min(tile_1.first, tile_2.first);
+       x <= std::max(tile_1.first, tile_2.first); ++x) {
+    for (long long y = std::min(tile_1.second, tile_2.second);
+         y <= std::max(tile_1.second, tile_2.second); ++y) {
+      if (!raster[x][y]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+int main() {
+  std::cout << "Running unit tests ..." << std::endl;
+
+  assert(area({2, 5}, {11, 1}) == 50);
+
+  std::cout << "\tUnits tests completed successfully." << std::endl;
+
+  std::cout << "Running AOC test ..." << std::endl;
+
+  std::vector<std::pair<long long, long long>> example_input = {
+      {7, 1}, {11, 1}, {11, 7}, {9, 7}, {9, 5}, {2, 5}, {2, 3}, {7, 3},
+  };
+
+  assert(largest_area(example_input) == 50);
+  assert(largest_area(read_file("input_test.txt")) == 50);
+  std::vector<int> example_curvature = {1, 1, 1, 1, -1, 1, 1, -1};
+  assert(evaluate_curvature(example_input) == example_curvature);
+  example_curvature = evaluate_curvature(example_input);
+
+  std::vector<std::pair<long long, long long>> example_ranges{
+      {-2, -1}, {7, 11}, {7, 11}, {2, 11},  {2, 11},
+      {2, 11},  {9, 11}, {9, 11}, {-2, -1},
+  };
+  ScanlineIndex example_rows(example_input);
+  ScanlineIndex example_columns(transpose(example_input));
+  for (long long i = 0; i < 14; ++i) {
+    for (long long j = 0; j < 9; ++j) {
+      if (example_ranges[j].first <= i && i <= example_ranges[j].second) {
+        assert(point_is_inside({i, j}, example_input, example_curvature));
+        assert(example_rows.contains({i, j}));
+        assert(example_columns.contains({j, i}));
+      } else {
+        assert(!point_is_inside({i, j}, example_input, example_curvature));
+        assert(!example_rows.contains({i, j}));
+        assert(!example_columns.contains({j, i}));
+      }
+    }
+  }
+  assert(example_rows.contains_segment(2, 11, 5));
+  assert(!example_rows.contains_segment(2, 11, 6));
+  assert(example_rows.contains_segment(9, 11, 6));
+  assert(example_columns.contains_segment(1, 7, 9));
+  assert(!example_columns.contains_segment(1, 7, 8));
+  assert(largest_area(example_input, true) == 24);
+
+  // Rows between vertex rows whose inside intervals touch, such as [3, 6] and
+  // [7, 8] for 3 < y < 6, have to be merged.
+  std::vector<std::pair<long long, long long>> touching_input{
+      {1, 7},  {1, 8},  {6, 8},  {6, 11}, {9, 11}, {9, 8},
+      {14, 8}, {14, 7}, {9, 7},  {9, 6},  {14, 6}, {14, 2},
+      {9, 2},  {9, 3},  {1, 3},  {1, 6},  {6, 6},  {6, 7}};
+  ScanlineIndex touching_rows(touching_input);
+  ScanlineIndex touching_columns(transpose(touching_input));
+  assert(rectangle_is_inside({5, 3}, {7, 7}, touching_rows, touching_columns));
+  assert(rectangle_is_inside({3, 6}, {7, 8}, touching_rows, touching_columns));
+  std::vector<std::vector<bool>> touching_raster =
+      rasterize(touching_input, 16, 13);
+  for (long long x1 = 0; x1 < 16; ++x1) {
+    for (long long y1 = 0; y1 < 13; ++y1) {
+      assert(touching_rows.contains({x1, y1}) == touching_raster[x1][y1]);
+      assert(touching_columns.contains({y1, x1}) == touching_raster[x1][y1]);
+      for (long long x2 = x1; x2 < 16; ++x2) {
+        for (long long y2 = 0; y2 < 13; ++y2) {
+          assert(rectangle_is_inside({x1, y1}, {x2, y2}, touching_rows,
+                                     touching_columns) ==
+                 rectangle_is_inside(touching_raster, {x1, y1}, {x2, y2}));
+        }
+      }
+    }
+  }
+
+  CompressedAxis example_x_axis(axis_coordinates(example_input, true));
+  std::vector<long long> example_x_values{2, 7, 9, 11};
+  assert(example_x_axis.values == example_x_values);
+  assert(example_x_axis.n_entries == 7);
+  assert(example_x_axis.entry(2) == 0);
+  assert(example_x_axis.entry(11) == 6);
+  CompressedRaster example_raster(example_input);
+  for (size_t i = 0; i < example_input.size(); ++i) {
+    for (size_t j = 0; j < example_input.size(); ++j) {
+      assert(example_raster.contains(example_input[i], example_input[j]) ==
+             rectangle_is_inside(example_input[i], example_input[j],
+                                 example_rows, example_columns));
+    }
+  }
+  assert(example_raster.contains({7, 1}, {11, 1}));
+  assert(example_raster.contains({2, 3}, {2, 5}));
+  assert(!example_raster.contains({2, 3}, {11, 7}));
+  assert(largest_area_compressed(example_input) == 24);
+  assert(largest_area_branch_and_bound(example_input) == 24);
+  assert(largest_area_branch_and_bound({{0, 0}}) == 0);
+  assert(largest_area_staircase(example_input) == 50);
+  std::vector<std::pair<long long, long long>> lower_left_example{{2, 3},
+                                                                 {7, 1}};
+  assert(lower_left_staircase(example_input) == lower_left_example);
+  std::vector<std::pair<long long, long long>> upper_right_example{{11, 7}};
+  assert(upper_right_staircase(example_input) == upper_right_example);
+  std::mt19937 generator(9);
+  for (int n_tiles : {1, 2, 3, 10, 100}) {
+    std::vector<std::pair<long long, long long>> random_tiles;
+    for (int i = 0; i < n_tiles; ++i) {
+      random_tiles.push_back({generator() % 50, generator() % 50});
+    }
+    assert(largest_area_staircase(random_tiles) == largest_area(random_tiles));
+  }
+  // Histograms of random columns on a common base line. Branch and bound has
+  // to agree with the full scan, and check only a small fraction of the pairs.
+  for (int n_columns : {2, 10, 100, 300}) {
+    std::vector<long long> xs{0}, heights;
+    long long height;
+    for (int i = 0; i < n_columns; ++i) {
+      xs.push_back(xs.back() + 1 + generator() % 5);
+      do {
+        height = 1 + generator() % 100;
+      } while (!heights.empty() && height == heights.back());
+      heights.push_back(height);
+    }
+    std::vector<std::pair<long long, long long>> histogram{{0, 0},
+                                                           {xs.back(), 0}};
+    for (int i = n_columns - 1; i >= 0; --i) {
+      histogram.push_back({xs[i + 1], heights[i]});
+      histogram.push_back({xs[i], heights[i]});
+    }
+    size_t n_checked_pairs;
+    assert(largest_area_branch_and_bound(histogram, ScanlineIndex(histogram),
+                                         ScanlineIndex(transpose(histogram)),
+                                         &n_checked_pairs) ==
+           largest_area(histogram, true));
+    assert(n_checked_pairs <= histogram.size());
+  }
+
+  Polygon example_polygon(read_file("input_test.txt"));
+  assert(example_polygon.largest_area() == 50);
+  assert(example_polygon.largest_area(true) == 24);
+  assert(example_polygon.contains({9, 6}));
+  assert(!example_polygon.contains({8, 6}));
+  std::vector<std::pair<std::pair<long long, long long>,
+                        std::pair<long long, long long>>>
+      example_rectangles;
+  for (long long x1 = 0; x1 < 13; x1 += 2) {
+    for (long long y1 = 0; y1 < 9; ++y1) {
+      for (long long x2 = 0; x2 < 13; x2 += 3) {
+        for (long long y2 = 0; y2 < 9; y2 += 2) {
+          example_rectangles.push_back({{x1, y1}, {x2, y2}});
+        }
+      }
+    }
+  }
+  std::vector<bool> example_rectangles_inside =
+      example_polygon.contains(example_rectangles);
+  bool all_inside;
+  long long x1, x2, y1, y2;
+  for (size_t i = 0; i < example_rectangles.size(); ++i) {
+    std::tie(x1, x2) = std::minmax(example_rectangles[i].first.first,
+                                   example_rectangles[i].second.first);
+    std::tie(y1, y2) = std::minmax(example_rectangles[i].first.second,
+                                   example_rectangles[i].second.second);
+    all_inside = true;
+    for (long long x = x1; x <= x2; ++x) {
+      for (long long y = y1; y <= y2; ++y) {
+        all_inside &= point_is_inside({x, y}, example_input, example_curvature);
+      }
+    }
+    assert(example_rectangles_inside[i] == all_inside);
+    assert(example_polygon.contains(example_rectangles[i].first,
+                                    example_rectangles[i].second) ==
+           all_inside);
+  }
+
+  // Rectangles with corners that are not vertices, in a polygon whose rows
+  // between vertex rows have touching intervals.
+  Polygon touching_polygon(touching_input);
+  std::vector<std::pair<std::pair<long long, long long>,
+                        std::pair<long long, long long>>>
+      touching_rectangles;
+  for (long long x1 = 0; x1 < 16; ++x1) {
+    for (long long y1 = 0; y1 < 13; ++y1) {
+      for (long long x2 = x1; x2 < 16; ++x2) {
+        for (long long y2 = 0; y2 < 13; ++y2) {
+          touching_rectangles.push_back({{x1, y1}, {x2, y2}});
+        }
+      }
+    }
+  }
+  std::vector<bool> touching_rectangles_inside =
+      touching_polygon.contains(touching_rectangles);
+  for (size_t i = 0; i < touching_rectangles.size(); ++i) {
+    all_inside = rectangle_is_inside(touching_raster,
+                                     touching_rectangles[i].first,
+                                     touching_rectangles[i].second);
+    assert(touching_rectangles_inside[i] == all_inside);
+    assert(touching_polygon.contains(touching_rectangles[i].first,
+                                     touching_rectangles[i].second) ==
+           all_inside);
+  }
+  long long touching_largest_area = 0;
+  for (auto tile_1 : touching_input) {
+    for (auto tile_2 : touching_input) {
+      if (rectangle_is_inside(touching_raster, tile_1, tile_2)) {
+        touching_largest_area =
+            std::max(touching_largest_area, area(tile_1, tile_2));
+      }
+    }
+  }
+  assert(touching_polygon.largest_area(true) == touching_largest_area);
+
+  for (unsigned n_threads : {1, 2, 5}) {
+    assert(largest_area_parallel(example_input, false, n_threads) == 50);
+    assert(largest_area_parallel(example_input, true, n_threads) == 24);
+  }
+
+  std::cout << "\tAOC test completed successfully." << std::endl;
+
+  return 0;
+}
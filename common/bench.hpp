@@ -0,0 +1,176 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Benchmark harness shared by all days. Every day registers its solvers and
+// kernels in a benchDD executable, which runs each of them for a number of
+// warmup and timed iterations and prints the statistics as JSON.
+//
+// Usage: benchDD [--warmup N] [--iterations N] [--filter TEXT]
+//                [--output JSON_FILE] [INPUT_FILE]
+namespace aoc {
+
+// Keeps the compiler from discarding a result that is not used otherwise.
+// The empty assembly statement may read the value through its address and
+// clobbers memory, so the value has to be fully computed before it.
+template <typename T> void do_not_optimize(const T &value) {
+  asm volatile("" : : "g"(&value) : "memory");
+}
+
+// Quoted JSON string with quotes, backslashes and control characters escaped.
+inline std::string json_string(const std::string &text) {
+  std::ostringstream result;
+  result << '"';
+  for (const unsigned char c : text) {
+    if (c == '"' || c == '\\') {
+      result << '\\' << c;
+    } else if (c < 0x20) {
+      result << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+             << (int)c << std::dec;
+    } else {
+      result << c;
+    }
+  }
+  result << '"';
+  return result.str();
+}
+
+// Peak resident set size of the process in KiB, or -1 if it is unknown.
+inline long peak_rss_kib() {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.rfind("VmHWM:", 0) == 0) {
+      return std::stol(line.substr(6));
+    }
+  }
+  return -1;
+}
+
+// Resets the peak resident set size to the current one, so that it can be
+// attributed to a single benchmark. Returns false if this is not supported.
+inline bool reset_peak_rss() {
+  std::ofstream clear_refs("/proc/self/clear_refs");
+  clear_refs << "5";
+  clear_refs.flush();
+  return clear_refs.good();
+}
+
+struct BenchmarkResult {
+  std::string name;
+  int n_iterations;
+  double median_ns;
+  double p95_ns;
+  double min_ns;
+  double throughput_mb_s;
+  long peak_rss_kib;
+};
+
+struct Benchmark {
+  std::string day;
+  std::string input_file_name = "input.txt";
+  std::uintmax_t input_bytes = 0;
+  int n_warmup = 1;
+  int n_iterations = 10;
+  std::string filter;
+  std::string output_file_name;
+  std::vector<std::pair<std::string, std::function<void()>>> cases;
+
+  Benchmark(const std::string day, int argc, char *argv[]) : day(day) {
+    for (int i = 1; i < argc; ++i) {
+      const std::string argument = argv[i];
+      if (argument == "--warmup" && i + 1 < argc) {
+        n_warmup = std::stoi(argv[++i]);
+      } else if (argument == "--iterations" && i + 1 < argc) {
+        n_iterations = std::max(1, std::stoi(argv[++i]));
+      } else if (argument == "--filter" && i + 1 < argc) {
+        filter = argv[++i];
+      } else if (argument == "--output" && i + 1 < argc) {
+        output_file_name = argv[++i];
+      } else {
+        input_file_name = argument;
+      }
+    }
+    std::ifstream file(input_file_name, std::ios::binary | std::ios::ate);
+    if (file) {
+      input_bytes = file.tellg();
+    }
+  }
+
+  void add(const std::string name, std::function<void()> function) {
+    if (name.find(filter) != std::string::npos) {
+      cases.push_back({name, function});
+    }
+  }
+
+  BenchmarkResult measure(const std::string &name,
+                          const std::function<void()> &function) const {
+    const bool rss_per_case = reset_peak_rss();
+    for (int i = 0; i < n_warmup; ++i) {
+      function();
+    }
+    std::vector<double> times_ns(n_iterations);
+    for (int i = 0; i < n_iterations; ++i) {
+      const auto start = std::chrono::steady_clock::now();
+      function();
+      times_ns[i] = std::chrono::duration<double, std::nano>(
+                        std::chrono::steady_clock::now() - start)
+                        .count();
+    }
+    std::sort(times_ns.begin(), times_ns.end());
+    const double median_ns =
+        n_iterations % 2 ? times_ns[n_iterations / 2]
+                         : 0.5 * (times_ns[n_iterations / 2 - 1] +
+                                  times_ns[n_iterations / 2]);
+    const size_t p95 = std::min<size_t>(n_iterations - 1,
+                                        (95 * n_iterations + 99) / 100 - 1);
+    return {name,
+            n_iterations,
+            median_ns,
+            times_ns[p95],
+            times_ns.front(),
+            input_bytes / median_ns * 1e3,
+            rss_per_case ? peak_rss_kib() : -1};
+  }
+
+  // Runs all registered cases and writes one JSON object to the output file,
+  // or to stdout if there is none.
+  int run() const {
+    std::ostringstream json;
+    json << std::setprecision(12);
+    json << "{\n  \"day\": " << json_string(day)
+         << ",\n  \"input\": " << json_string(input_file_name)
+         << ",\n  \"input_bytes\": " << input_bytes
+         << ",\n  \"warmup\": " << n_warmup << ",\n  \"benchmarks\": [";
+    for (size_t i = 0; i < cases.size(); ++i) {
+      const BenchmarkResult result = measure(cases[i].first, cases[i].second);
+      json << (i ? "," : "")
+           << "\n    {\"name\": " << json_string(result.name)
+           << ", \"iterations\": " << result.n_iterations
+           << ", \"median_ns\": " << result.median_ns
+           << ", \"p95_ns\": " << result.p95_ns
+           << ", \"min_ns\": " << result.min_ns
+           << ", \"throughput_mb_s\": " << result.throughput_mb_s
+           << ", \"peak_rss_kib\": " << result.peak_rss_kib << "}";
+    }
+    json << "\n  ]\n}\n";
+    if (output_file_name.empty()) {
+      std::cout << json.str();
+      return 0;
+    }
+    std::ofstream output(output_file_name);
+    output << json.str();
+    return output.good() ? 0 : 1;
+  }
+};
+
+} // namespace aoc
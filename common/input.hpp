@@ -0,0 +1,92 @@
+#pragma once
+
+#include <charconv>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+// Input layer shared by all days. The whole file is read into one buffer with
+// a single allocation, and lines and fields are handed out as views into that
+// buffer, so parsing does not allocate per line or per number.
+namespace aoc {
+
+// Returns the content of the file, or an empty string if it cannot be opened,
+// which matches the behavior of reading it with getline.
+inline std::string read_input(const std::string &input_file_name) {
+  std::ifstream file(input_file_name, std::ios::binary | std::ios::ate);
+  if (!file) {
+    return {};
+  }
+  std::string content(static_cast<size_t>(file.tellg()), '\0');
+  file.seekg(0);
+  file.read(content.data(), content.size());
+  content.resize(file.gcount());
+  return content;
+}
+
+// Iterates over the lines of a buffer like getline: a trailing newline does
+// not produce an empty last line, and a carriage return before the newline is
+// dropped.
+struct LineReader {
+  std::string_view text;
+  size_t position = 0;
+
+  LineReader(const std::string_view text) : text(text) {}
+
+  bool next(std::string_view &line) {
+    if (position >= text.size()) {
+      return false;
+    }
+    size_t end = text.find('\n', position);
+    if (end == std::string_view::npos) {
+      end = text.size();
+    }
+    line = text.substr(position, end - position);
+    if (!line.empty() && line.back() == '\r') {
+      line.remove_suffix(1);
+    }
+    position = end + 1;
+    return true;
+  }
+};
+
+// Parses an integer like std::stoi and std::stoll: leading spaces are
+// skipped, trailing characters are ignored, and an std::invalid_argument or
+// std::out_of_range is thrown if there is no number.
+template <typename T> T parse_integer(std::string_view text) {
+  while (!text.empty() && text.front() == ' ') {
+    text.remove_prefix(1);
+  }
+  if (!text.empty() && text.front() == '+') {
+    text.remove_prefix(1);
+  }
+  T value{};
+  auto [end, error] =
+      std::from_chars(text.data(), text.data() + text.size(), value);
+  if (error == std::errc::invalid_argument) {
+    throw std::invalid_argument("parse_integer: no number in '" +
+                                std::string(text) + "'");
+  }
+  if (error == std::errc::result_out_of_range) {
+    throw std::out_of_range("parse_integer: '" + std::string(text) +
+                            "' out of range");
+  }
+  return value;
+}
+
+inline std::vector<std::string_view> split(const std::string_view text,
+                                           const char delimiter) {
+  std::vector<std::string_view> result;
+  size_t start = 0, end;
+  while ((end = text.find(delimiter, start)) != std::string_view::npos) {
+    result.push_back(text.substr(start, end - start));
+    start = end + 1;
+  }
+  result.push_back(text.substr(start));
+  return result;
+}
+
+} // namespace aoc
@@ -0,0 +1,184 @@
+#pragma once
+
+// Hot-path instrumentation. With AOC_INSTRUMENT defined, the macros below
+// record phase timings, latency histograms and event counters, and a
+// per-phase breakdown is printed to stderr when the program exits. Without
+// it, they expand to nothing.
+//
+// AOC_PHASE("08/evaluate_distances");  // times the rest of the scope
+// AOC_COUNT("08/merges");              // counts one event
+// AOC_COUNT_N("04/removed", n);        // counts n events
+// AOC_PEAK("04/grid_bytes", n);        // keeps the largest n
+
+#ifdef AOC_INSTRUMENT
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace aoc::instrument {
+
+struct Counter {
+  std::atomic<std::uint64_t> value{0};
+
+  void maximize(const std::uint64_t candidate) {
+    std::uint64_t current = value;
+    while (current < candidate &&
+           !value.compare_exchange_weak(current, candidate)) {
+    }
+  }
+};
+
+// Calls of a phase, their total time, and a histogram of their durations with
+// one bucket per power of two nanoseconds.
+struct Phase {
+  std::atomic<std::uint64_t> n_calls{0};
+  std::atomic<std::uint64_t> total_ns{0};
+  std::array<std::atomic<std::uint64_t>, 64> histogram{};
+
+  void record(const std::uint64_t ns) {
+    ++n_calls;
+    total_ns += ns;
+    ++histogram[std::bit_width(ns)];
+  }
+
+  // Upper bound of the duration below which a fraction q of the calls end.
+  std::uint64_t quantile_ns(const double q) const {
+    const std::uint64_t threshold = q * n_calls;
+    std::uint64_t n = 0;
+    for (size_t bucket = 0; bucket < histogram.size(); ++bucket) {
+      n += histogram[bucket];
+      if (n > threshold) {
+        return std::uint64_t{1} << bucket;
+      }
+    }
+    return 0;
+  }
+};
+
+struct Registry {
+  std::mutex mutex;
+  std::map<std::string, Phase> phases;
+  std::map<std::string, Counter> counters;
+  std::map<std::string, Counter> peaks;
+
+  static Registry &instance() {
+    static Registry registry;
+    return registry;
+  }
+
+  Phase &phase(const std::string &name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return phases[name];
+  }
+
+  Counter &counter(const std::string &name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return counters[name];
+  }
+
+  Counter &peak(const std::string &name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return peaks[name];
+  }
+
+  void report(std::ostream &out) {
+    std::lock_guard<std::mutex> lock(mutex);
+    out << "Instrumentation:\n" << std::fixed << std::setprecision(3);
+    out << std::left << std::setw(36) << "  phase" << std::right
+        << std::setw(10) << "calls" << std::setw(14) << "total ms"
+        << std::setw(12) << "mean us" << std::setw(12) << "p50 us <"
+        << std::setw(12) << "p99 us <" << "\n";
+    std::vector<std::pair<const std::string, Phase> *> sorted;
+    for (auto &phase : phases) {
+      sorted.push_back(&phase);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](auto *a, auto *b) {
+      return a->second.total_ns > b->second.total_ns;
+    });
+    for (auto *phase : sorted) {
+      const Phase &p = phase->second;
+      const double mean_ns =
+          p.n_calls ? (double)p.total_ns / p.n_calls : 0.;
+      out << "  " << std::left << std::setw(34) << phase->first << std::right
+          << std::setw(10) << p.n_calls << std::setw(14) << p.total_ns * 1e-6
+          << std::setw(12) << mean_ns * 1e-3 << std::setw(12)
+          << p.quantile_ns(0.5) * 1e-3 << std::setw(12)
+          << p.quantile_ns(0.99) * 1e-3 << "\n";
+    }
+    out << std::left << std::setw(36) << "  counter" << std::right
+        << std::setw(10) << "value" << "\n";
+    for (auto &[name, counter] : counters) {
+      out << "  " << std::left << std::setw(34) << name << std::right
+          << std::setw(10) << counter.value << "\n";
+    }
+    out << std::left << std::setw(36) << "  peak" << std::right
+        << std::setw(10) << "value" << "\n";
+    for (auto &[name, peak] : peaks) {
+      out << "  " << std::left << std::setw(34) << name << std::right
+          << std::setw(10) << peak.value << "\n";
+    }
+    out << std::flush;
+  }
+
+  ~Registry() {
+    if (!phases.empty() || !counters.empty() || !peaks.empty()) {
+      report(std::cerr);
+    }
+  }
+};
+
+struct ScopedTimer {
+  Phase &phase;
+  std::chrono::steady_clock::time_point start;
+
+  ScopedTimer(Phase &phase)
+      : phase(phase), start(std::chrono::steady_clock::now()) {}
+
+  ~ScopedTimer() {
+    phase.record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                     std::chrono::steady_clock::now() - start)
+                     .count());
+  }
+};
+
+} // namespace aoc::instrument
+
+#define AOC_CONCAT_(a, b) a##b
+#define AOC_CONCAT(a, b) AOC_CONCAT_(a, b)
+#define AOC_PHASE(name)                                                        \
+  static aoc::instrument::Phase &AOC_CONCAT(aoc_phase_, __LINE__) =            \
+      aoc::instrument::Registry::instance().phase(name);                       \
+  aoc::instrument::ScopedTimer AOC_CONCAT(aoc_timer_, __LINE__)(               \
+      AOC_CONCAT(aoc_phase_, __LINE__))
+#define AOC_COUNT_N(name, n)                                                   \
+  do {                                                                         \
+    static aoc::instrument::Counter &aoc_counter =                             \
+        aoc::instrument::Registry::instance().counter(name);                   \
+    aoc_counter.value += (n);                                                  \
+  } while (0)
+#define AOC_COUNT(name) AOC_COUNT_N(name, 1)
+#define AOC_PEAK(name, n)                                                      \
+  do {                                                                         \
+    static aoc::instrument::Counter &aoc_peak =                                \
+        aoc::instrument::Registry::instance().peak(name);                      \
+    aoc_peak.maximize(n);                                                      \
+  } while (0)
+
+#else
+
+#define AOC_PHASE(name) static_cast<void>(0)
+#define AOC_COUNT_N(name, n) static_cast<void>(0)
+#define AOC_COUNT(name) static_cast<void>(0)
+#define AOC_PEAK(name, n) static_cast<void>(0)
+
+#endif
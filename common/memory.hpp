@@ -0,0 +1,79 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+
+#include "common/instrument.hpp"
+
+namespace aoc {
+
+// Forwards to an upstream resource and counts the allocations and bytes that
+// pass through it. Like the resources it wraps, it is not thread-safe.
+struct CountingResource : std::pmr::memory_resource {
+  std::pmr::memory_resource *upstream;
+  size_t n_allocations = 0;
+  size_t bytes = 0;
+  size_t peak_bytes = 0;
+
+  CountingResource(std::pmr::memory_resource *upstream) : upstream(upstream) {}
+
+  void *do_allocate(const size_t n_bytes, const size_t alignment) override {
+    void *p = upstream->allocate(n_bytes, alignment);
+    ++n_allocations;
+    bytes += n_bytes;
+    peak_bytes = std::max(peak_bytes, bytes);
+    return p;
+  }
+
+  void do_deallocate(void *p, const size_t n_bytes,
+                     const size_t alignment) override {
+    upstream->deallocate(p, n_bytes, alignment);
+    bytes -= n_bytes;
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource &other) const
+      noexcept override {
+    return this == &other;
+  }
+};
+
+// Memory for one phase of a solver. Containers allocate from resource(), and
+// the allocations they request are counted, as well as the ones that are
+// passed on to the heap. With AOC_INSTRUMENT, both counts and the peak of the
+// heap memory are reported under the given name.
+template <typename Resource> struct CountedResource {
+  std::string name;
+  CountingResource heap;
+  Resource buffer;
+  CountingResource requests;
+
+  CountedResource(const std::string &name)
+      : name(name), heap(std::pmr::get_default_resource()), buffer(&heap),
+        requests(&buffer) {}
+
+  CountedResource(const CountedResource &) = delete;
+  CountedResource &operator=(const CountedResource &) = delete;
+
+#ifdef AOC_INSTRUMENT
+  ~CountedResource() {
+    auto &registry = aoc::instrument::Registry::instance();
+    registry.counter(name + "/requests").value += requests.n_allocations;
+    registry.counter(name + "/heap_allocations").value += heap.n_allocations;
+    registry.peak(name + "/heap_bytes").maximize(heap.peak_bytes);
+  }
+#endif
+
+  std::pmr::memory_resource *resource() { return &requests; }
+};
+
+// Hands out memory from growing chunks and frees all of it at once at the
+// end, for data that lives until the end of the phase.
+using Arena = CountedResource<std::pmr::monotonic_buffer_resource>;
+
+// Recycles freed blocks of the same size, for data that is freed and
+// allocated again over and over.
+using Pool = CountedResource<std::pmr::unsynchronized_pool_resource>;
+
+} // namespace aoc
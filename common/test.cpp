@@ -0,0 +1,25 @@
+#undef NDEBUG
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "common/input.hpp"
+
+int main() {
+  std::cout << "Running unit tests ..." << std::endl;
+  std::vector<std::string_view> test_fields = {"11-22", "", "95-115"};
+  assert(aoc::split("11-22,,95-115", ',') == test_fields);
+  assert(aoc::parse_integer<long long>(" 2121212124\r") == 2121212124);
+  aoc::LineReader test_lines("a\r\n\nb\n");
+  std::string_view test_line;
+  assert(test_lines.next(test_line) && test_line == "a");
+  assert(test_lines.next(test_line) && test_line.empty());
+  assert(test_lines.next(test_line) && test_line == "b");
+  assert(!test_lines.next(test_line));
+
+  std::cout << "\tCommon test completed successfully." << std::endl;
+
+  return 0;
+}
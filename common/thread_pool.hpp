@@ -0,0 +1,133 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace aoc {
+
+// Fixed set of worker threads with one task deque each. Tasks submitted from
+// a worker go to the back of its own deque, other tasks are dealt out round
+// robin. A worker takes tasks from the back of its own deque and, once that
+// is empty, steals from the front of the others.
+struct ThreadPool {
+  struct Queue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  std::vector<std::unique_ptr<Queue>> queues;
+  std::vector<std::thread> workers;
+  std::mutex mutex;
+  std::condition_variable work_available;
+  std::condition_variable all_done;
+  size_t n_queued = 0;
+  size_t n_pending = 0;
+  bool stopping = false;
+  std::atomic<size_t> next_queue{0};
+
+  ThreadPool(unsigned n_threads = std::thread::hardware_concurrency()) {
+    n_threads = std::max(1u, n_threads);
+    for (unsigned i = 0; i < n_threads; ++i) {
+      queues.push_back(std::make_unique<Queue>());
+    }
+    for (unsigned i = 0; i < n_threads; ++i) {
+      workers.emplace_back([this, i]() { work(i); });
+    }
+  }
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    work_available.notify_all();
+    for (std::thread &worker : workers) {
+      worker.join();
+    }
+  }
+
+  // Index of the worker of this pool that runs the calling thread, or -1.
+  int current_worker() const {
+    for (size_t i = 0; i < workers.size(); ++i) {
+      if (workers[i].get_id() == std::this_thread::get_id()) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  void submit(std::function<void()> task) {
+    const int worker = current_worker();
+    Queue &queue = *queues[worker >= 0 ? worker
+                                       : next_queue++ % queues.size()];
+    {
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.tasks.push_back(std::move(task));
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      ++n_queued;
+      ++n_pending;
+    }
+    work_available.notify_one();
+  }
+
+  // Blocks until every submitted task has finished.
+  void wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    all_done.wait(lock, [this]() { return n_pending == 0; });
+  }
+
+  bool take(const size_t worker, std::function<void()> &task) {
+    for (size_t n = 0; n < queues.size(); ++n) {
+      Queue &queue = *queues[(worker + n) % queues.size()];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (queue.tasks.empty()) {
+        continue;
+      }
+      if (n == 0) {
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+      } else {
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+      }
+      return true;
+    }
+    return false;
+  }
+
+  void work(const size_t worker) {
+    std::function<void()> task;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        work_available.wait(lock, [this]() { return stopping || n_queued; });
+        if (n_queued == 0) {
+          return;
+        }
+        // Reserves one task, so that the workers that are woken up never
+        // outnumber the tasks in the queues.
+        --n_queued;
+      }
+      while (!take(worker, task)) {
+        std::this_thread::yield();
+      }
+      task();
+      task = nullptr;
+      std::lock_guard<std::mutex> lock(mutex);
+      if (--n_pending == 0) {
+        all_done.notify_all();
+      }
+    }
+  }
+};
+
+} // namespace aoc
@@ -0,0 +1,332 @@
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Writes random, but valid, puzzle inputs of any size for every day.
+//
+// Usage: generate DD COUNT [--seed N] [--width N] [--output FILE]
+//
+// COUNT is the number of lines for 01, 03, 04, 05 and 07, ranges for 02,
+// problems for 06, points for 08 and vertices for 09. It accepts the suffixes
+// k, M and G. The output only depends on the arguments, so a seed always
+// reproduces the same file.
+
+// SplitMix64, which is fully specified, unlike the distributions of <random>.
+std::uint64_t mix(std::uint64_t x) {
+  x += 0x9e3779b97f4a7c15ull;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+  return x ^ (x >> 31);
+}
+
+struct Random {
+  std::uint64_t state;
+
+  Random(const std::uint64_t seed) : state(mix(seed)) {}
+
+  std::uint64_t next() { return mix(state++); }
+
+  // Uniform in [low, high].
+  long long between(const long long low, const long long high) {
+    return low + next() % (std::uint64_t)(high - low + 1);
+  }
+
+  bool chance(const double probability) {
+    return (next() >> 11) * 0x1.0p-53 < probability;
+  }
+};
+
+// Collects output in a large buffer, so that gigabyte-sized files are written
+// in a few big chunks.
+struct Writer {
+  std::ostream &out;
+  std::string buffer;
+  static constexpr size_t chunk_size = 1 << 20;
+
+  Writer(std::ostream &out) : out(out) { buffer.reserve(2 * chunk_size); }
+
+  ~Writer() { flush(); }
+
+  void flush() {
+    out.write(buffer.data(), buffer.size());
+    buffer.clear();
+  }
+
+  Writer &operator<<(const char c) {
+    buffer += c;
+    return *this;
+  }
+
+  Writer &operator<<(const std::string &s) {
+    buffer += s;
+    if (buffer.size() >= chunk_size) {
+      flush();
+    }
+    return *this;
+  }
+
+  Writer &operator<<(const long long n) {
+    char digits[24];
+    buffer.append(digits, std::to_chars(digits, digits + 24, n).ptr);
+    return *this;
+  }
+
+  void end_line() {
+    buffer += '\n';
+    if (buffer.size() >= chunk_size) {
+      flush();
+    }
+  }
+};
+
+// Rotations "L68" or "R48".
+void generate_01(Writer &out, Random &random, const long long count) {
+  for (long long i = 0; i < count; ++i) {
+    out << (random.chance(0.5) ? 'L' : 'R') << random.between(1, 999);
+    out.end_line();
+  }
+}
+
+// One line of disjoint, increasing ID ranges "11-22,95-115".
+void generate_02(Writer &out, Random &random, const long long count,
+                 const long long width) {
+  long long start = random.between(1, 100);
+  for (long long i = 0; i < count; ++i) {
+    const long long end = start + random.between(0, width);
+    out << (i ? "," : "") << start << '-' << end;
+    start = end + random.between(1, 100 * width);
+  }
+  out.end_line();
+}
+
+// Battery banks of width digits from 1 to 9.
+void generate_03(Writer &out, Random &random, const long long count,
+                 const long long width) {
+  std::string line(width, ' ');
+  for (long long i = 0; i < count; ++i) {
+    for (char &c : line) {
+      c = '0' + random.between(1, 9);
+    }
+    out << line;
+    out.end_line();
+  }
+}
+
+// Grid of paper rolls '@' and empty cells '.'.
+void generate_04(Writer &out, Random &random, const long long count,
+                 const long long width) {
+  std::string line(width, ' ');
+  for (long long i = 0; i < count; ++i) {
+    for (char &c : line) {
+      c = random.chance(0.7) ? '@' : '.';
+    }
+    out << line;
+    out.end_line();
+  }
+}
+
+// Fresh ID ranges, which may overlap, an empty line and the available IDs.
+// About a quarter of the lines are ranges.
+void generate_05(Writer &out, Random &random, const long long count) {
+  const long long max_id = 1000000000000000ll;
+  const long long n_ranges = std::max(1ll, count / 4);
+  for (long long i = 0; i < n_ranges; ++i) {
+    const long long start = random.between(1, max_id);
+    out << start << '-' << start + random.between(0, max_id / n_ranges);
+    out.end_line();
+  }
+  out.end_line();
+  for (long long i = n_ranges; i < count; ++i) {
+    out << random.between(1, max_id);
+    out.end_line();
+  }
+}
+
+// Worksheet with count problems side by side, separated by a column of
+// spaces. Every problem has three numbers with up to three digits from 1 to
+// 9, aligned to the left or to the right, and the operator in the last row
+// below its first column. Both ways of reading the numbers then stay far
+// below the range of long long, even for billions of problems.
+void generate_06(Writer &out, Random &random, const long long count) {
+  const int n_numbers = 3;
+  const std::uint64_t seed = random.next();
+  // The problems are generated again for every row from their own seed, and
+  // the digits of every row from a seed of their own, so that memory does not
+  // grow with the size of the worksheet.
+  for (int row = 0; row <= n_numbers; ++row) {
+    for (long long problem = 0; problem < count; ++problem) {
+      Random problem_random(seed ^ mix(problem));
+      const bool left_aligned = problem_random.chance(0.5);
+      const bool multiply = problem_random.chance(0.5);
+      int lengths[n_numbers];
+      int width = 0;
+      for (int &length : lengths) {
+        length = problem_random.between(1, 3);
+        width = std::max(width, length);
+      }
+      std::string cell(width, ' ');
+      if (row == n_numbers) {
+        cell[0] = multiply ? '*' : '+';
+      } else {
+        Random digit_random(problem_random.next() ^ mix(row));
+        const int offset = left_aligned ? 0 : width - lengths[row];
+        for (int n = 0; n < lengths[row]; ++n) {
+          cell[offset + n] = '0' + digit_random.between(1, 9);
+        }
+      }
+      out << (problem ? " " : "") << cell;
+    }
+    out.end_line();
+  }
+}
+
+// Tachyon manifold: the source 'S' in the middle of the first row, and
+// splitters '^' on every other row. The splitters of one row all have the
+// same column parity, which alternates from row to row, so that no two
+// splitters are neighbors, and they stay away from the borders.
+void generate_07(Writer &out, Random &random, const long long count,
+                 const long long width) {
+  std::string line(width, '.');
+  line[width / 2] = 'S';
+  out << line;
+  out.end_line();
+  for (long long i = 1; i < count; ++i) {
+    std::fill(line.begin(), line.end(), '.');
+    if (i % 2 == 0) {
+      for (long long column = 2 - (width / 2 + i / 2 + 1) % 2;
+           column < width - 1; column += 2) {
+        if (random.chance(0.5)) {
+          line[column] = '^';
+        }
+      }
+    }
+    out << line;
+    out.end_line();
+  }
+}
+
+// Junction box positions "162,817,812".
+void generate_08(Writer &out, Random &random, const long long count) {
+  for (long long i = 0; i < count; ++i) {
+    out << random.between(0, 99999) << ',' << random.between(0, 99999) << ','
+        << random.between(0, 99999);
+    out.end_line();
+  }
+}
+
+// Red tiles at the vertices of a random x-monotone rectilinear polygon. Column
+// i spans x_i to x_(i + 1), with its bottom edge at y = bottom_i and its top
+// edge at y = top_i. All bottoms lie below all tops, so neighboring columns
+// always overlap, and the parity of i keeps neighboring edges at different
+// heights. The vertices run along the bottom from left to right and back
+// along the top, and every coordinate is computed directly from i, so memory
+// does not grow with the size of the polygon.
+void generate_09(Writer &out, Random &random, const long long count) {
+  const long long n_columns = std::max(1ll, count / 4);
+  const std::uint64_t seed = random.next();
+  const long long height = 50000;
+  auto value = [&](const long long i, const std::uint64_t stream,
+                   const long long range) {
+    return (long long)(mix(seed ^ mix(4 * i + stream)) % range);
+  };
+  auto x = [&](const long long i) { return 8 * i + value(i, 0, 6); };
+  auto bottom = [&](const long long i) {
+    return 2 * value(i, 1, height) + i % 2;
+  };
+  auto top = [&](const long long i) {
+    return 2 * height + 2 + 2 * value(i, 2, height) + i % 2;
+  };
+  auto vertex = [&](const long long vertex_x, const long long vertex_y) {
+    out << vertex_x << ',' << vertex_y;
+    out.end_line();
+  };
+  for (long long i = 0; i < n_columns; ++i) {
+    vertex(x(i), bottom(i));
+    vertex(x(i + 1), bottom(i));
+  }
+  for (long long i = n_columns - 1; i >= 0; --i) {
+    vertex(x(i + 1), top(i));
+    vertex(x(i), top(i));
+  }
+}
+
+long long parse_count(const std::string &argument) {
+  size_t end;
+  long long count = std::stoll(argument, &end);
+  const std::string suffix = argument.substr(end);
+  if (suffix == "k") {
+    count *= 1000ll;
+  } else if (suffix == "M") {
+    count *= 1000000ll;
+  } else if (suffix == "G") {
+    count *= 1000000000ll;
+  } else if (!suffix.empty()) {
+    throw std::invalid_argument("Unknown suffix '" + suffix + "'");
+  }
+  return count;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc < 3) {
+    std::cerr << "Usage: " << argv[0]
+              << " DD COUNT [--seed N] [--width N] [--output FILE]"
+              << std::endl;
+    return 1;
+  }
+  const std::string day = argv[1];
+  const long long count = parse_count(argv[2]);
+  std::uint64_t seed = 2025;
+  long long width = 0;
+  std::string output_file_name;
+  for (int i = 3; i + 1 < argc; i += 2) {
+    const std::string option = argv[i];
+    if (option == "--seed") {
+      seed = std::stoull(argv[i + 1]);
+    } else if (option == "--width") {
+      width = parse_count(argv[i + 1]);
+    } else if (option == "--output") {
+      output_file_name = argv[i + 1];
+    } else {
+      std::cerr << "Unknown option " << option << std::endl;
+      return 1;
+    }
+  }
+
+  std::unique_ptr<std::ofstream> file;
+  if (!output_file_name.empty()) {
+    file = std::make_unique<std::ofstream>(output_file_name, std::ios::binary);
+  }
+  Random random(seed);
+  {
+    Writer out(file ? *file : std::cout);
+    if (day == "01") {
+      generate_01(out, random, count);
+    } else if (day == "02") {
+      generate_02(out, random, count, width ? width : 1000);
+    } else if (day == "03") {
+      generate_03(out, random, count, width ? width : 100);
+    } else if (day == "04") {
+      generate_04(out, random, count, width ? width : count);
+    } else if (day == "05") {
+      generate_05(out, random, count);
+    } else if (day == "06") {
+      generate_06(out, random, count);
+    } else if (day == "07") {
+      generate_07(out, random, count, width ? width : 141);
+    } else if (day == "08") {
+      generate_08(out, random, count);
+    } else if (day == "09") {
+      generate_09(out, random, count);
+    } else {
+      std::cerr << "Unknown day " << day << std::endl;
+      return 1;
+    }
+  }
+  return file && !file->good() ? 1 : 0;
+}
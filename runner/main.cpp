@@ -0,0 +1,178 @@
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "01/solver.hpp"
+#include "02/solver.hpp"
+#include "03/solver.hpp"
+#include "04/solver.hpp"
+#include "05/solver.hpp"
+#include "06/solver.hpp"
+#include "07/solver.hpp"
+#include "08/solver.hpp"
+#include "09/solver.hpp"
+#include "common/thread_pool.hpp"
+
+// Solves any number of inputs for any days in one process.
+//
+// Usage: aoc [--threads N] [DD [INPUT_FILE ...] ...]
+//
+// Every DD is followed by the input files for that day, DD/input.txt if there
+// are none. Without any days on the command line, the tasks are read from
+// stdin, one "DD [INPUT_FILE]" per line. All tasks run concurrently on one
+// thread pool, and their results are printed in the order of the tasks.
+
+// Solvers get a budget of threads that they may use for themselves, so that
+// the tasks together do not start more threads than the pool has workers.
+using Solver = std::array<std::string, 2> (*)(const std::string, unsigned);
+
+template <std::array<std::string, 2> (*solve)(const std::string)>
+std::array<std::string, 2> single_threaded(const std::string input_file_name,
+                                           unsigned) {
+  return solve(input_file_name);
+}
+
+const std::map<std::string, Solver> solvers{
+    {"01", single_threaded<day01::solve>},
+    {"02", single_threaded<day02::solve>},
+    {"03", single_threaded<day03::solve>},
+    {"04", single_threaded<day04::solve>},
+    {"05", single_threaded<day05::solve>},
+    {"06", single_threaded<day06::solve>},
+    {"07", single_threaded<day07::solve>},
+    {"08", day08::solve},
+    {"09", single_threaded<day09::solve>},
+};
+
+struct Task {
+  std::string day;
+  std::string input_file_name;
+  std::array<std::string, 2> result;
+  std::string error;
+  double milliseconds = 0.;
+
+  Task(const std::string &day, const std::string &input_file_name)
+      : day(day), input_file_name(input_file_name) {}
+
+  void run(const unsigned n_threads) {
+    const auto start = std::chrono::steady_clock::now();
+    if (!std::ifstream(input_file_name)) {
+      error = "Cannot open " + input_file_name;
+    } else {
+      try {
+        result = solvers.at(day)(input_file_name, n_threads);
+      } catch (const std::exception &exception) {
+        error = exception.what();
+      }
+    }
+    milliseconds = std::chrono::duration<double, std::milli>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+  }
+};
+
+bool is_day(const std::string &argument) {
+  return solvers.count(argument) > 0;
+}
+
+std::string default_input(const std::string &day) {
+  return day + "/input.txt";
+}
+
+int main(int argc, char *argv[]) {
+  unsigned n_threads = std::thread::hardware_concurrency();
+  std::vector<Task> tasks;
+  std::string day;
+  bool day_has_input = true;
+  auto finish_day = [&]() {
+    if (!day_has_input) {
+      tasks.emplace_back(day, default_input(day));
+    }
+  };
+  for (int i = 1; i < argc; ++i) {
+    const std::string argument = argv[i];
+    if (argument == "--threads" && i + 1 < argc) {
+      const std::string_view text = argv[++i];
+      const auto [end, error] =
+          std::from_chars(text.data(), text.data() + text.size(), n_threads);
+      if (error != std::errc() || end != text.data() + text.size() ||
+          n_threads == 0) {
+        std::cerr << "Expected a positive number of threads instead of '"
+                  << argv[i] << "'" << std::endl;
+        return 1;
+      }
+    } else if (is_day(argument)) {
+      finish_day();
+      day = argument;
+      day_has_input = false;
+    } else if (!day.empty()) {
+      tasks.emplace_back(day, argument);
+      day_has_input = true;
+    } else {
+      std::cerr << "Expected a day instead of '" << argument << "'"
+                << std::endl;
+      return 1;
+    }
+  }
+  finish_day();
+  if (tasks.empty()) {
+    std::string line, input_file_name;
+    while (std::getline(std::cin, line)) {
+      std::istringstream fields(line);
+      if (!(fields >> day)) {
+        continue;
+      }
+      if (!is_day(day)) {
+        std::cerr << "Unknown day '" << day << "'" << std::endl;
+        return 1;
+      }
+      if (!(fields >> input_file_name)) {
+        input_file_name = default_input(day);
+      }
+      tasks.emplace_back(day, input_file_name);
+    }
+  }
+
+  n_threads = std::max(1u, n_threads);
+  const unsigned n_threads_per_task =
+      std::max<size_t>(1, n_threads / std::max<size_t>(1, tasks.size()));
+  const auto start = std::chrono::steady_clock::now();
+  {
+    aoc::ThreadPool pool(n_threads);
+    for (Task &task : tasks) {
+      pool.submit([&task, n_threads_per_task]() {
+        task.run(n_threads_per_task);
+      });
+    }
+    pool.wait();
+  }
+  const double milliseconds = std::chrono::duration<double, std::milli>(
+                                  std::chrono::steady_clock::now() - start)
+                                  .count();
+
+  int exit_code = 0;
+  for (const Task &task : tasks) {
+    std::cout << task.day << " " << task.input_file_name;
+    if (task.error.empty()) {
+      std::cout << " (" << task.milliseconds << " ms)" << std::endl;
+      std::cout << "\tResult 1/2: " << task.result[0] << std::endl;
+      std::cout << "\tResult 2/2: " << task.result[1] << std::endl;
+    } else {
+      std::cout << " failed" << std::endl;
+      std::cout << "\tError: " << task.error << std::endl;
+      exit_code = 1;
+    }
+  }
+  std::cout << tasks.size() << " tasks on " << n_threads << " threads in "
+            << milliseconds << " ms" << std::endl;
+  return exit_code;
+}